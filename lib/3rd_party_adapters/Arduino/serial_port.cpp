@@ -42,6 +42,11 @@ void setCallbackForLineReception(const StringHandler &callback)
     incomingStringHandler = callback;
 }
 
+void setCallbackForDataReception(const std::function<void(void)> &callback)
+{
+    Serial.onReceive(callback);
+}
+
 } // namespace serial_port
 
 void serial_port::readAndHandleInput()
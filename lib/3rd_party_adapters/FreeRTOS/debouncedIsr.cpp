@@ -1,8 +1,13 @@
 #include <Arduino.h>
-#include <cassert>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <esp_timer.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
+#include <input_device_interface/DebounceScheduler.hpp>
 #include <input_device_interface/debouncedIsr.hpp>
+#include <optional>
 
 int debouncer::minPriorityToInt()
 {
@@ -20,9 +25,9 @@ int debouncer::defaultPriorityToInt()
 }
 
 /**
- * Non-memorizing startup delay for debouncing.
+ * Non-memorizing startup delays for debouncing.
  *
- * Based of FreeRTOS task notifications.
+ * Based on a single FreeRTOS task and task notifications.
  *
  * Using a startup delay has the advantage, that short pulses (shorter than the debounce period) will have no effect.
  * In contrast classical debouncing trough ignoring changes for the debounce period, after an initial change, may
@@ -30,123 +35,106 @@ int debouncer::defaultPriorityToInt()
  *
  * Operation:
  *
- * - if the interrupt function (typically called by an interrupt), provided by \ref getInterruptFunction()
- *   is called, a timer for the startup delay will start
- * - if the interrupt function is called again the timer will restart
- * - when the timer expires, the handler will be called
+ * - if the interrupt function of a debouncer is called (typically by an interrupt),
+ *   the debouncer's channel of the scheduler is signalled with a timestamp and the task is notified
+ * - the task restarts the debounce time of each signalled channel
+ * - the task sleeps until the next debounce time expires or until it is notified again
+ * - when a debounce time expires, the handler will be called by the task
+ *   with the timestamp of the first interrupt of the burst
+ *
+ * Compared to a task per debouncer, only one stack is needed.
  *
  * \see \ref debouncing_approaches
  */
-class Debouncer
+namespace
 {
-  public:
-    /**
-     * Setup and start an (initially idle) startup delay task.
-     *
-     * @tparam Rep Rep, an arithmetic type representing the number of ticks
-     * @tparam Period a std::ratio representing the tick period (i.e. the number of seconds per tick)
-     * @param handler is a function to be called when the timer expires
-     * @param debounceTime is the startup delay
-     * @param priority is the priority in which the delay task and therefore the handler shall be called
-     */
-    template <class Rep, class Period>
-    Debouncer(
-        std::function<void(void)> handler,
-        std::chrono::duration<Rep, Period> debounceTime,
-        int priority = debouncer::defaultPriorityToInt())
-        : handler(handler),
-          debounceTaskHandle(nullptr),
-          startupDelay(pdMS_TO_TICKS(std::chrono::duration_cast<std::chrono::milliseconds>(debounceTime).count()))
-    {
-        xTaskCreate(pinDebounce, "pinDebounce", stackSize, this, priority, &debounceTaskHandle);
-    }
-
-    /**
-     * Indicates minimum free memory on the task specific stack.
-     *
-     * This can be used to estimate the necessary stack size for the task.
-     *
-     * @return number of minimum free words on the task
-     */
-    UBaseType_t getTaskStackHighWaterMark() const
-    {
-        return uxTaskGetStackHighWaterMark(debounceTaskHandle);
-    }
+/**
+ * Maximum number of debouncers.
+ */
+constexpr std::size_t maxNumberOfDebouncers = 16;
 
-    /**
-     * Provides the function to be used to indicate state changes to be debounced.
-     *
-     * @returns a function which must be called when the observed state changes
-     */
-    std::function<void(void)> getInterruptFunction() const
-    {
-        return std::bind(&Debouncer::interruptServiceRoutine, this);
-    }
+/**
+ * The necessary stack size in words.
+ *
+ * Has been determined by measuring the stack high water mark and by experimenting.
+ * Handlers only queue events, so the demand does not grow with the number of debouncers.
+ */
+constexpr configSTACK_DEPTH_TYPE stackSize = configMINIMAL_STACK_SIZE + 708 + 1'000;
 
-  private:
-    std::function<void(void)> handler;
-    mutable TaskHandle_t debounceTaskHandle;
-    TickType_t startupDelay;
+DebounceScheduler<debouncer::Clock, maxNumberOfDebouncers> scheduler;
+TaskHandle_t debounceTaskHandle = nullptr;
 
-    /**
-     * The necessary stack size in words.
-     *
-     * Has been determined by measuring the stack high water mark and by experimenting.
-     */
-    static constexpr configSTACK_DEPTH_TYPE stackSize = configMINIMAL_STACK_SIZE + 708 + 1'000;
+/**
+ * Reads the current point in time within an interrupt.
+ *
+ * `esp_timer_get_time()` is safe to be called from interrupts.
+ * It counts the microseconds since boot, which is the same time base as used by `std::chrono::steady_clock` of ESP-IDF.
+ *
+ * \returns the current point in time
+ */
+debouncer::Clock::time_point ARDUINO_ISR_ATTR getTimestampFromIsr()
+{
+    return debouncer::Clock::time_point(std::chrono::microseconds(esp_timer_get_time()));
+}
 
-    /**
-     * Triggers the startup delay.
-     *
-     * This is designed such that it may be called from an interrupt.
-     * It is non-blocking and as short as possible
-     */
-    void ARDUINO_ISR_ATTR interruptServiceRoutine() const
+/**
+ * Waits for the debounce times and calls the handlers.
+ *
+ * @param parameter unused
+ */
+void debounce(void *const parameter)
+{
+    std::optional<debouncer::Clock::duration> timeout;
+    while (true)
     {
-        BaseType_t higherPriorityTaskWoken = pdFALSE;
-        vTaskNotifyGiveFromISR(debounceTaskHandle, &higherPriorityTaskWoken);
-        portYIELD_FROM_ISR(higherPriorityTaskWoken);
+        const TickType_t ticksToWait = timeout ? std::max<TickType_t>(1, pdMS_TO_TICKS(std::chrono::ceil<std::chrono::milliseconds>(*timeout).count()))
+                                               : portMAX_DELAY;
+        ulTaskNotifyTake(pdTRUE, ticksToWait);
+        timeout = scheduler.process(debouncer::Clock::now());
     }
+}
 
-    /**
-     * Performs the actual startup delay.
-     *
-     * \internal
-     * Function must be `static` in order to be able to provide a raw function pointer.
-     * In order to access the debouncer's non-static members, a pointer to the debouncer object
-     * must be provided.
-     * \endinternal
-     *
-     * @param parameter must be a pointer to the debouncer object used for debouncing
-     */
-    static void pinDebounce(void *const parameter)
-    {
-        assert(parameter);
-        const Debouncer &debouncer = *reinterpret_cast<const Debouncer *>(parameter);
-        while (true)
-        {
-            // prepare for incoming notification
-            xTaskNotifyStateClear(nullptr);
-
-            // first stage: wait for start
-            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
-
-            // second stage: wait for uninterrupted period
-            while (ulTaskNotifyTake(pdTRUE, debouncer.startupDelay) > 0)
-            {
-                continue; // has been interrupted, wait again
-            }
-
-            debouncer.handler();
-        }
-    }
-};
+/**
+ * Triggers the startup delay of a debouncer.
+ *
+ * This is designed such that it may be called from an interrupt.
+ * It is non-blocking and as short as possible.
+ *
+ * @param id identifies the debouncer
+ */
+void ARDUINO_ISR_ATTR interruptServiceRoutine(const std::size_t id)
+{
+    scheduler.signal(id, getTimestampFromIsr());
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+    vTaskNotifyGiveFromISR(debounceTaskHandle, &higherPriorityTaskWoken);
+    portYIELD_FROM_ISR(higherPriorityTaskWoken);
+}
+} // namespace
 
 std::function<void(void)> createDebouncer(
-    const std::function<void(void)> handler,
+    const debouncer::Handler handler,
     const std::chrono::milliseconds debounceTime,
     const int priority)
 {
-    const auto *const debouncer = new Debouncer(handler, debounceTime, priority);
-    return debouncer->getInterruptFunction();
+    const auto id = scheduler.addChannel(handler, debounceTime);
+    if (!debounceTaskHandle)
+    {
+        xTaskCreate(debounce, "debounce", stackSize, nullptr, priority, &debounceTaskHandle);
+    }
+    else if (static_cast<UBaseType_t>(priority) > uxTaskPriorityGet(debounceTaskHandle))
+    {
+        vTaskPrioritySet(debounceTaskHandle, priority);
+    }
+    return std::bind(interruptServiceRoutine, id);
+}
+
+debouncer::Statistics debouncer::getStatistics()
+{
+    const std::size_t numberOfDebouncers = scheduler.size();
+    return {
+        .numberOfDebouncers = numberOfDebouncers,
+        .stackSize = stackSize,
+        .stackHighWaterMark = debounceTaskHandle ? uxTaskGetStackHighWaterMark(debounceTaskHandle) : 0,
+        .reclaimedStack = numberOfDebouncers > 1 ? (numberOfDebouncers - 1) * stackSize : 0,
+    };
 }
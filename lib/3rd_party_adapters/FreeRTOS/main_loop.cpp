@@ -0,0 +1,50 @@
+#include <Arduino.h>
+#include <algorithm>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <load_meter.hpp>
+#include <scheduling/main_loop.hpp>
+
+/**
+ * Task of the main loop.
+ *
+ * The main loop is notified using the task notification of its task.
+ */
+static TaskHandle_t mainLoopTask = nullptr;
+
+/**
+ * Load of the main loop; the time it waits for work is idle.
+ */
+static LoadMeter load("main loop", ARDUINO_RUNNING_CORE);
+
+void main_loop::initialize()
+{
+    mainLoopTask = xTaskGetCurrentTaskHandle();
+}
+
+void ARDUINO_ISR_ATTR main_loop::notify()
+{
+    if (!mainLoopTask)
+    {
+        return;
+    }
+    if (xPortInIsrContext())
+    {
+        BaseType_t higherPriorityTaskWoken = pdFALSE;
+        vTaskNotifyGiveFromISR(mainLoopTask, &higherPriorityTaskWoken);
+        portYIELD_FROM_ISR(higherPriorityTaskWoken);
+    }
+    else
+    {
+        xTaskNotifyGive(mainLoopTask);
+    }
+}
+
+bool main_loop::waitForWork(const std::chrono::milliseconds timeout)
+{
+    const TickType_t ticksToWait = pdMS_TO_TICKS(std::max<std::chrono::milliseconds::rep>(0, timeout.count()));
+    load.startWaiting(LoadMeter::Clock::now());
+    const bool isNotified = ulTaskNotifyTake(pdTRUE, ticksToWait) > 0;
+    load.stopWaiting(LoadMeter::Clock::now());
+    return isNotified;
+}
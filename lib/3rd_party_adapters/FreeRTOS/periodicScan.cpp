@@ -0,0 +1,31 @@
+#include <algorithm>
+#include <chrono>
+#include <freertos/FreeRTOS.h>
+#include <freertos/timers.h>
+#include <functional>
+#include <input_device_interface/periodicScan.hpp>
+
+/**
+ * Calls the scan function of a timer.
+ *
+ * @param timer whose ID is the scan function
+ */
+static void callScan(const TimerHandle_t timer)
+{
+    const auto &scan = *static_cast<std::function<void(void)> *>(pvTimerGetTimerID(timer));
+    scan();
+}
+
+/**
+ * Uses a FreeRTOS software timer.
+ *
+ * The scan function is called by the timer service task.
+ * Thus no additional stack is needed.
+ */
+void startPeriodicScan(const std::function<void(void)> scan, const std::chrono::milliseconds period)
+{
+    // the timer runs forever, thus the function is never deleted
+    auto *const timerScan = new std::function<void(void)>(scan);
+    const TimerHandle_t timer = xTimerCreate("scan", std::max<TickType_t>(1, pdMS_TO_TICKS(period.count())), pdTRUE, timerScan, callScan);
+    xTimerStart(timer, portMAX_DELAY);
+}
@@ -0,0 +1,46 @@
+#include <display_interface/transferWorker.hpp>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <functional>
+
+/**
+ * The necessary stack size.
+ *
+ * The transfer only calls the I2C driver.
+ */
+static constexpr configSTACK_DEPTH_TYPE stackSize = 3'072;
+
+/**
+ * Priority of the worker.
+ *
+ * Above the GUI task, so a transfer starts as soon as it is triggered.
+ * While the bus transfers, the worker waits for the I2C driver and the GUI task renders.
+ */
+static constexpr UBaseType_t priority = 2;
+
+/**
+ * Body of a transfer worker task.
+ *
+ * \param parameter the transfer function
+ */
+static void work(void *const parameter)
+{
+    const auto &transfer = *static_cast<std::function<void(void)> *>(parameter);
+    while (true)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        transfer();
+    }
+}
+
+/**
+ * Uses a FreeRTOS task which waits for its task notification.
+ */
+std::function<void(void)> startTransferWorker(const std::function<void(void)> transfer)
+{
+    // the task runs forever, thus the function is never deleted
+    auto *const taskTransfer = new std::function<void(void)>(transfer);
+    TaskHandle_t task = nullptr;
+    xTaskCreate(work, "display", stackSize, taskTransfer, priority, &task);
+    return [task]() { xTaskNotifyGive(task); };
+}
@@ -4,7 +4,11 @@
  */
 #include "GuiEngine.hpp"
 #include "Screen.hpp"
+#include "keypadInput.hpp"
+#include "pageLayoutRendering.hpp"
 #include <Adafruit_SSD1306.h>
+#include <algorithm>
+#include <display_interface/transferWorker.hpp>
 #include <memory>
 #include <user_interaction/MenuItem.hpp>
 
@@ -18,26 +22,28 @@ static void lvgl_log_to_serial(const char *buf)
 #endif
 
 /* Display flushing */
+
+/**
+ * Copies the rendered area into the back buffer of the frames and marks its pages as dirty.
+ *
+ * Nothing is sent to the display here; \ref GuiEngine::refresh() submits the frame to the transfer worker.
+ */
 static void flushSSD1306Adafruit(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p)
 {
     const auto displayAdapter = reinterpret_cast<GuiEngine *>(disp_drv->user_data);
     auto &display = displayAdapter->display;
-    uint32_t width = (area->x2 - area->x1 + 1);
-    uint32_t height = (area->y2 - area->y1 + 1);
-
-    for (uint16_t row = 0; row < height; row++)
-    {
-        for (uint16_t col = 0; col < width; col++)
-        {
-            display.drawPixel(area->x1 + col, area->y1 + row, (color_p->full) ? SSD1306_WHITE : SSD1306_BLACK);
-            color_p++;
-        }
-    }
-    //this->display.display();  // this has been removed from here due to performance, as multiple flushes are triggered, when more areas on screen are refreshed
+    const auto pageArea = toPageLayoutArea(*area);
+    page_layout::copyPages(displayAdapter->frames.getBackBuffer(), display.width(), pageArea, reinterpret_cast<const std::uint8_t *>(color_p));
+    // a frame may consist of multiple flushes when more areas on screen are refreshed
+    displayAdapter->frames.mark(pageArea);
+    displayAdapter->redrawnPixels += lv_area_get_size(area);
     lv_disp_flush_ready(disp_drv);
 }
 
-static IKeypad *myKeypad = nullptr;
+/**
+ * Time after which a frame is submitted again, if the display has been busy.
+ */
+static constexpr std::chrono::milliseconds retryTransferInterval{5};
 
 /**
  * @brief Construct a new Gui Engine:: GuiEngine object
@@ -46,8 +52,10 @@ static IKeypad *myKeypad = nullptr;
  * @param i2c           - reference to the i2c/TwoWire object for communication
  */
 GuiEngine::GuiEngine(const Configuration &configuration, TwoWire &i2c)
-    : display(configuration.screen_width, configuration.screen_height, &i2c),
-      buf(std::make_unique<lv_color_t[]>(configuration.screen_width * 16))
+    : display(configuration.screen_width, configuration.screen_height, &i2c, configuration.i2cClock),
+      frames(display, configuration.screen_width, configuration.screen_height),
+      buf(std::make_unique<lv_color_t[]>(configuration.screen_width * 16)),
+      triggerTransfer(startTransferWorker([this]() { frames.transfer(); }))
 {
 #if LV_USE_LOG != 0
     lv_log_register_print_cb(lvgl_log_to_serial); /* register print function for debugging */
@@ -69,6 +77,7 @@ GuiEngine::GuiEngine(const Configuration &configuration, TwoWire &i2c)
     display.display();
 
     // Initialize lvgl library
+    // the size is given in pixels, but rendering into the page layout uses only one bit per pixel
     static lv_disp_draw_buf_t draw_buf;
     lv_init();
     lv_disp_draw_buf_init(&draw_buf, buf.get(), NULL, configuration.screen_width * 16);
@@ -79,6 +88,8 @@ GuiEngine::GuiEngine(const Configuration &configuration, TwoWire &i2c)
     disp_drv.hor_res = configuration.screen_width;
     disp_drv.ver_res = configuration.screen_height;
     disp_drv.flush_cb = flushSSD1306Adafruit;
+    disp_drv.set_px_cb = setPixelInPages;
+    disp_drv.rounder_cb = roundToPages;
     disp_drv.draw_buf = &draw_buf;
     disp_drv.user_data = this;
 
@@ -89,6 +100,7 @@ GuiEngine::GuiEngine(const Configuration &configuration, TwoWire &i2c)
     // Create monochomatic theme and set it as default
     lv_theme_t *mono_theme = lv_theme_mono_init(0, false, &lv_font_unscii_8);
     lv_disp_set_theme(0, mono_theme);
+    createScreenStyles();
 
     // create first text in lvgl
     lv_obj_t *label = lv_label_create(lv_scr_act());
@@ -99,58 +111,6 @@ GuiEngine::GuiEngine(const Configuration &configuration, TwoWire &i2c)
     lv_timer_handler();
 }
 
-/**
- * @brief implementation for lvgl read_cb for the left key
- */
-static void keypad_read_left(lv_indev_drv_t *indev_drv, lv_indev_data_t *data)
-{
-    if (!myKeypad)
-        return;
-
-    // assign key state
-    data->state = (myKeypad->isKeyPressed(KeyId::LEFT)) ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
-    data->key = LV_KEY_PREV;
-}
-
-/**
- * @brief implementation for lvgl read_cb for the right key
- */
-static void keypad_read_right(lv_indev_drv_t *indev_drv, lv_indev_data_t *data)
-{
-    if (!myKeypad)
-        return;
-
-    // assign key state
-    data->state = (myKeypad->isKeyPressed(KeyId::RIGHT)) ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
-    data->key = LV_KEY_NEXT;
-}
-
-/**
- * @brief implementation for lvgl read_cb for the enter key
- */
-static void keypad_read_enter(lv_indev_drv_t *indev_drv, lv_indev_data_t *data)
-{
-    if (!myKeypad)
-        return;
-
-    // assign key state
-    data->state = (myKeypad->isKeyPressed(KeyId::ENTER)) ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
-    data->key = LV_KEY_ENTER;
-}
-
-/**
- * @brief implementation for lvgl read_cb for the back key
- */
-static void keypad_read_back(lv_indev_drv_t *indev_drv, lv_indev_data_t *data)
-{
-    if (!myKeypad)
-        return;
-
-    // assign key state
-    data->state = (myKeypad->isKeyPressed(KeyId::BACK)) ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
-    data->key = LV_KEY_ESC;
-}
-
 /**
  * @brief register the Keypad to read the button states from
  * 
@@ -158,52 +118,37 @@ static void keypad_read_back(lv_indev_drv_t *indev_drv, lv_indev_data_t *data)
  */
 void GuiEngine::registerKeyPad(IKeypad *keypad)
 {
-    //assign keypad reference to local pointer
-    myKeypad = keypad;
-
-    // create default group for button navigation and assign input device to it
-    static lv_group_t *const group = lv_group_create();
-    lv_group_set_default(group);
-
-    // Register all buttons as individual indev, so they all have their separate "old" state (lvgl has only one "old" state per indev)
-    static lv_indev_drv_t indev_drv_left;
-    lv_indev_drv_init(&indev_drv_left);
-    indev_drv_left.type = LV_INDEV_TYPE_KEYPAD;
-    indev_drv_left.read_cb = keypad_read_left;
-
-    static lv_indev_drv_t indev_drv_right;
-    lv_indev_drv_init(&indev_drv_right);
-    indev_drv_right.type = LV_INDEV_TYPE_KEYPAD;
-    indev_drv_right.read_cb = keypad_read_right;
-
-    static lv_indev_drv_t indev_drv_enter;
-    lv_indev_drv_init(&indev_drv_enter);
-    indev_drv_enter.type = LV_INDEV_TYPE_KEYPAD;
-    indev_drv_enter.read_cb = keypad_read_enter;
-
-    static lv_indev_drv_t indev_drv_back;
-    lv_indev_drv_init(&indev_drv_back);
-    indev_drv_back.type = LV_INDEV_TYPE_KEYPAD;
-    indev_drv_back.read_cb = keypad_read_back;
-
-    // Register the drivers in LVGL and save the created input device object
-    lv_indev_set_group(lv_indev_drv_register(&indev_drv_left), group);
-    lv_indev_set_group(lv_indev_drv_register(&indev_drv_right), group);
-    lv_indev_set_group(lv_indev_drv_register(&indev_drv_enter), group);
-    lv_indev_set_group(lv_indev_drv_register(&indev_drv_back), group);
+    registerKeypadInput(keypad);
 }
 
 /**
  * @brief cyclic function to be called to handle lvgl
- *   This also flushes the data to the display.
+ *   When LVGL has rendered a frame, it is submitted to the transfer worker, which sends the dirty pages to the display.
  * 
+ * @returns the time until the next timer of lvgl is due
  */
-void GuiEngine::refresh()
+std::chrono::milliseconds GuiEngine::refresh()
 {
-    lv_timer_handler();
-    LV_LOG_TRACE("Adafruit display() start");
-    this->display.display();
-    LV_LOG_TRACE("Adafruit display() end");
+    const std::uint32_t timeUntilNextTimer = lv_timer_handler();
+    if (redrawnPixels > 0)
+    {
+        redrawnArea.set(redrawnPixels);
+        redrawnPixels = 0;
+    }
+    if (frames.submit())
+    {
+        triggerTransfer();
+    }
+    // counted also if nothing has been sent, so the rate drops when idle
+    transferredBytes.count(display.takeTransferredBytes(), RateMeter::Clock::now());
+
+    if (frames.hasPendingChanges())
+    {
+        // the previous frame is still transferred, retry soon
+        return std::min(std::chrono::milliseconds(timeUntilNextTimer), retryTransferInterval);
+    }
+    // is LV_NO_TIMER_READY if no timer is active
+    return std::chrono::milliseconds(timeUntilNextTimer);
 }
 
 /**
@@ -213,6 +158,6 @@ void GuiEngine::refresh()
  */
 void GuiEngine::drawMenu(const MenuItemList *menuList)
 {
-    CurrentScreen = std::make_shared<ScreenMenu>(*menuList);
-    CurrentScreen->draw();
+    screenHistory.clear();
+    screenHistory.push<ScreenMenu>(menuList)->draw();
 }
@@ -1,9 +1,14 @@
 #pragma once
 
-#include <Adafruit_SSD1306.h>
+#include "SSD1306Display.hpp"
+#include <chrono>
 #include <cstdint>
+#include <display_interface/TransferPipeline.hpp>
+#include <functional>
+#include <gauge.hpp>
 #include <lvgl.h>
 #include <memory>
+#include <rate_meter.hpp>
 #include <user_interaction/IGuiEngine.hpp>
 
 /**
@@ -19,14 +24,36 @@ class GuiEngine : public IGuiEngine
         std::uint8_t screen_height;
         bool generateDisplayVoltageInternally;
         std::uint8_t display_i2c_address;
+        std::uint32_t i2cClock; ///< clock frequency of the I2C bus of the display in Hz
     };
     GuiEngine(const Configuration &configuration, TwoWire &i2c);
     virtual void registerKeyPad(IKeypad *keypad) override;
-    virtual void refresh() override;
+    virtual std::chrono::milliseconds refresh() override;
     virtual void drawMenu(const MenuItemList *menuList) override;
 
-    Adafruit_SSD1306 display;
+    SSD1306Display display;
+
+    /**
+     * Frame buffers LVGL draws to, while the previous frame is transferred to the display.
+     */
+    TransferPipeline frames;
+
+    /**
+     * Pixels LVGL has redrawn during the current refresh.
+     */
+    std::uint32_t redrawnPixels = 0;
 
   private:
     const std::unique_ptr<lv_color_t[]> buf;
+    const std::function<void(void)> triggerTransfer;
+
+    /**
+     * Bytes sent to the display.
+     */
+    RateMeter transferredBytes{"display I2C", "bytes"};
+
+    /**
+     * Pixels redrawn per frame; shows whether changes are redrawn incrementally.
+     */
+    Gauge redrawnArea{"display area redrawn", "pixels"};
 };
@@ -0,0 +1,94 @@
+/**
+ * \file .
+ * Runs the GUI engine in a task of its own.
+ */
+#include "GuiTask.hpp"
+#include <algorithm>
+#include <serial_interface/serial_port.hpp>
+
+using namespace std::chrono_literals;
+
+/**
+ * Maximum number of messages waiting for the GUI task.
+ */
+static constexpr UBaseType_t queueLength = 8;
+
+/**
+ * Maximum time the GUI task sleeps, even if LVGL has nothing to do.
+ */
+static constexpr auto maximumSleepTime = 500ms;
+
+GuiTask::GuiTask(const EngineFactory &createEngine, const Configuration &configuration)
+    : createEngine(createEngine),
+      messages(xQueueCreate(queueLength, sizeof(Message))),
+      load("GUI", configuration.core)
+{
+    if (!messages || (xTaskCreatePinnedToCore(run, "GUI", configuration.stackSize, this, configuration.priority, nullptr, configuration.core) != pdPASS))
+    {
+        serial_port::cout << "ERROR: GUI task could not be created" << std::endl;
+    }
+}
+
+void GuiTask::registerKeyPad(IKeypad *keypad)
+{
+    send({.type = Message::Type::REGISTER_KEYPAD, .keypad = keypad, .menuList = nullptr});
+}
+
+std::chrono::milliseconds GuiTask::refresh()
+{
+    return std::chrono::milliseconds::max();
+}
+
+void GuiTask::drawMenu(const MenuItemList *menuList)
+{
+    send({.type = Message::Type::DRAW_MENU, .keypad = nullptr, .menuList = menuList});
+}
+
+/**
+ * Queues a message for the GUI task.
+ *
+ * Blocks while the queue is full, as messages must not get lost.
+ *
+ * \param message is copied to the queue
+ */
+void GuiTask::send(const Message &message)
+{
+    xQueueSend(messages, &message, portMAX_DELAY);
+}
+
+/**
+ * Body of the GUI task.
+ *
+ * Creates the engine and alternates between refreshing it and waiting for messages.
+ * The engine is refreshed when LVGL's next timer is due or after a message has been handled.
+ *
+ * \param parameter the GuiTask object
+ */
+void GuiTask::run(void *const parameter)
+{
+    GuiTask &self = *static_cast<GuiTask *>(parameter);
+    IGuiEngine &engine = self.createEngine();
+    std::chrono::milliseconds timeout = 0ms;
+    while (true)
+    {
+        self.load.startWaiting(LoadMeter::Clock::now());
+        Message message;
+        BaseType_t isReceived = xQueueReceive(self.messages, &message, pdMS_TO_TICKS(std::clamp(timeout, 0ms, maximumSleepTime).count()));
+        self.load.stopWaiting(LoadMeter::Clock::now());
+
+        while (isReceived == pdTRUE)
+        {
+            switch (message.type)
+            {
+            case Message::Type::REGISTER_KEYPAD:
+                engine.registerKeyPad(message.keypad);
+                break;
+            case Message::Type::DRAW_MENU:
+                engine.drawMenu(message.menuList);
+                break;
+            }
+            isReceived = xQueueReceive(self.messages, &message, 0);
+        }
+        timeout = engine.refresh();
+    }
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <chrono>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+#include <functional>
+#include <load_meter.hpp>
+#include <user_interaction/IGuiEngine.hpp>
+
+/**
+ * Runs a GuiEngine in a dedicated FreeRTOS task.
+ *
+ * LVGL is not thread-safe; therefore the engine is created and used exclusively by this task.
+ * Calls to the interface are forwarded to the task as messages through a queue.
+ * Hence, slow operations like the transfer to the display do not delay the caller, and vice versa.
+ */
+class GuiTask : public IGuiEngine
+{
+  public:
+    /**
+     * Creates the engine in the context of the GUI task.
+     *
+     * Everything the engine needs, like the bus to the display, should be initialized here.
+     */
+    typedef std::function<IGuiEngine &(void)> EngineFactory;
+
+    struct Configuration
+    {
+        BaseType_t core;               ///< processor core the task is pinned to
+        UBaseType_t priority;          ///< priority of the task
+        configSTACK_DEPTH_TYPE stackSize; ///< stack size of the task as expected by `xTaskCreatePinnedToCore()`
+    };
+
+    GuiTask(const EngineFactory &createEngine, const Configuration &configuration);
+    GuiTask(const GuiTask &) = delete;
+    GuiTask &operator=(const GuiTask &) = delete;
+
+    virtual void registerKeyPad(IKeypad *keypad) override;
+
+    /**
+     * The GUI task refreshes the engine on its own.
+     *
+     * \returns the maximum duration, as the caller never needs to call this for the GUI
+     */
+    virtual std::chrono::milliseconds refresh() override;
+    virtual void drawMenu(const MenuItemList *menuList) override;
+
+  private:
+    struct Message
+    {
+        enum class Type
+        {
+            REGISTER_KEYPAD,
+            DRAW_MENU,
+        } type;
+        IKeypad *keypad;              ///< for REGISTER_KEYPAD
+        const MenuItemList *menuList; ///< for DRAW_MENU
+    };
+
+    static void run(void *parameter);
+    void send(const Message &message);
+
+    const EngineFactory createEngine;
+    QueueHandle_t messages;
+    LoadMeter load;
+};
@@ -0,0 +1,99 @@
+/**
+ * \file .
+ * Connects LVGL to a frame buffer in RAM.
+ */
+#include "HeadlessGuiEngine.hpp"
+#include "Screen.hpp"
+#include "keypadInput.hpp"
+#include "pageLayoutRendering.hpp"
+#include <display_interface/pbm.hpp>
+
+#if !LV_TICK_CUSTOM // the engine drives the tick of LVGL, see lv_conf.h
+
+/**
+ * Number of rows LVGL renders at once, as done by GuiEngine.
+ */
+static constexpr page_layout::Coordinate drawBufferRows = 16;
+
+HeadlessGuiEngine::HeadlessGuiEngine(const page_layout::Coordinate width, const page_layout::Coordinate height)
+    : width(width), height(height),
+      framebuffer(std::make_unique<std::uint8_t[]>(static_cast<std::size_t>(width) * height / page_layout::pageHeight)),
+      buf(std::make_unique<lv_color_t[]>(static_cast<std::size_t>(width) * drawBufferRows)),
+      tickTime(Clock::now())
+{
+    lv_init();
+    // the size is given in pixels, but rendering into the page layout uses only one bit per pixel
+    lv_disp_draw_buf_init(&draw_buf, buf.get(), NULL, width * drawBufferRows);
+
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.hor_res = width;
+    disp_drv.ver_res = height;
+    disp_drv.flush_cb = flush;
+    disp_drv.set_px_cb = setPixelInPages;
+    disp_drv.rounder_cb = roundToPages;
+    disp_drv.draw_buf = &draw_buf;
+    disp_drv.user_data = this;
+    lv_disp_drv_register(&disp_drv);
+
+    lv_theme_t *mono_theme = lv_theme_mono_init(0, false, &lv_font_unscii_8);
+    lv_disp_set_theme(0, mono_theme);
+    createScreenStyles();
+}
+
+/**
+ * Copies the rendered pages into the frame buffer.
+ */
+void HeadlessGuiEngine::flush(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p)
+{
+    const auto engine = reinterpret_cast<HeadlessGuiEngine *>(disp_drv->user_data);
+    const auto begin = Clock::now();
+    page_layout::copyPages(engine->framebuffer.get(), engine->width, toPageLayoutArea(*area), reinterpret_cast<const std::uint8_t *>(color_p));
+    engine->timings.flush += Clock::now() - begin;
+    ++engine->timings.flushedAreas;
+    engine->timings.flushedPixels += lv_area_get_size(area);
+    lv_disp_flush_ready(disp_drv);
+}
+
+void HeadlessGuiEngine::registerKeyPad(IKeypad *keypad)
+{
+    registerKeypadInput(keypad);
+}
+
+std::chrono::milliseconds HeadlessGuiEngine::refresh()
+{
+    // advance by whole milliseconds only, so no time gets lost
+    const auto now = Clock::now();
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - tickTime);
+    lv_tick_inc(elapsed.count());
+    tickTime += elapsed;
+
+    timings = {};
+    const auto begin = Clock::now();
+    const std::uint32_t timeUntilNextTimer = lv_timer_handler();
+    timings.render = Clock::now() - begin;
+
+    // is LV_NO_TIMER_READY if no timer is active
+    return std::chrono::milliseconds(timeUntilNextTimer);
+}
+
+void HeadlessGuiEngine::drawMenu(const MenuItemList *menuList)
+{
+    screenHistory.clear();
+    screenHistory.push<ScreenMenu>(menuList)->draw();
+}
+
+void HeadlessGuiEngine::skipTime(const std::chrono::milliseconds duration)
+{
+    lv_tick_inc(duration.count());
+}
+
+bool HeadlessGuiEngine::isPixelOn(const page_layout::Coordinate x, const page_layout::Coordinate y) const
+{
+    return page_layout::getPixel(framebuffer.get(), width, x, y);
+}
+
+void HeadlessGuiEngine::writePbm(std::ostream &output) const
+{
+    ::writePbm(output, framebuffer.get(), width, height);
+}
+#endif
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <display_interface/page_layout.hpp>
+#include <lvgl.h>
+#include <memory>
+#include <ostream>
+#include <user_interaction/IGuiEngine.hpp>
+
+/**
+ * LVGL engine which renders into a frame buffer in RAM instead of a display.
+ *
+ * Renders the same way as GuiEngine, directly into the page layout of the SSD1306.
+ * Thus the screens can be run, inspected and benchmarked by unit tests on the host.
+ *
+ * The LVGL tick is advanced by the time passed between refreshes, plus the time skipped by skipTime().
+ * Only one engine may exist, as LVGL is a singleton which cannot be deinitialized; it must not be destroyed.
+ */
+class HeadlessGuiEngine : public IGuiEngine
+{
+  public:
+    typedef std::chrono::steady_clock Clock;
+
+    /**
+     * Durations measured during the last refresh.
+     */
+    struct Timings
+    {
+        Clock::duration render; ///< processing of LVGL, including flushing
+        Clock::duration flush;  ///< copying the rendered areas into the frame buffer
+        std::uint32_t flushedAreas;
+        std::uint32_t flushedPixels; ///< size of the flushed areas, after rounding to pages
+    };
+
+    HeadlessGuiEngine(page_layout::Coordinate width, page_layout::Coordinate height);
+    HeadlessGuiEngine(const HeadlessGuiEngine &) = delete;
+    HeadlessGuiEngine &operator=(const HeadlessGuiEngine &) = delete;
+
+    virtual void registerKeyPad(IKeypad *keypad) override;
+    virtual std::chrono::milliseconds refresh() override;
+    virtual void drawMenu(const MenuItemList *menuList) override;
+
+    /**
+     * Lets time pass for LVGL without waiting.
+     *
+     * For example, the display is redrawn after LV_DISP_DEF_REFR_PERIOD and keys are read after LV_INDEV_DEF_READ_PERIOD.
+     * Takes effect with the next refresh.
+     */
+    void skipTime(std::chrono::milliseconds duration);
+
+    bool isPixelOn(page_layout::Coordinate x, page_layout::Coordinate y) const;
+
+    /**
+     * Writes the frame buffer as portable bitmap.
+     *
+     * \param output stream to write to; must be opened in binary mode
+     */
+    void writePbm(std::ostream &output) const;
+
+    const Timings &getTimings() const
+    {
+        return timings;
+    }
+
+  private:
+    static void flush(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p);
+
+    const page_layout::Coordinate width;
+    const page_layout::Coordinate height;
+    const std::unique_ptr<std::uint8_t[]> framebuffer;
+    const std::unique_ptr<lv_color_t[]> buf;
+    lv_disp_draw_buf_t draw_buf;
+    lv_disp_drv_t disp_drv;
+
+    /**
+     * Point in time up to which the LVGL tick has been advanced.
+     */
+    Clock::time_point tickTime;
+
+    Timings timings{};
+};
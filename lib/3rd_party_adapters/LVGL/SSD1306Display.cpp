@@ -0,0 +1,82 @@
+#include "SSD1306Display.hpp"
+#include <Wire.h>
+#include <algorithm>
+
+/**
+ * Maximum number of bytes per I2C transmission, including the control byte.
+ *
+ * Limited by the buffer of the Wire library.
+ */
+static constexpr std::size_t maxBytesPerTransmission = std::min<std::size_t>(I2C_BUFFER_LENGTH, 256);
+
+/**
+ * Control byte announcing display data.
+ */
+static constexpr std::uint8_t controlByteData = 0x40;
+
+SSD1306Display::SSD1306Display(const std::uint8_t width, const std::uint8_t height, TwoWire *const i2c, const std::uint32_t i2cClock)
+    : Adafruit_SSD1306(width, height, i2c, -1, i2cClock, i2cClock)
+{
+}
+
+void SSD1306Display::transfer(const std::uint8_t *const framebuffer, const DirtyPages &changes)
+{
+    std::uint32_t bytesSent = 0;
+    changes.forEachWindow([this, framebuffer, &bytesSent](const DirtyPages::Window &window) { bytesSent += transfer(framebuffer, window); });
+    transferredBytes.fetch_add(bytesSent, std::memory_order_relaxed);
+}
+
+std::uint32_t SSD1306Display::takeTransferredBytes()
+{
+    return transferredBytes.exchange(0, std::memory_order_relaxed);
+}
+
+/**
+ * Transfers a window of the frame buffer.
+ *
+ * \param framebuffer content of the whole display
+ * \param window columns and pages to be transferred
+ * \returns number of bytes sent over I2C
+ */
+std::uint32_t SSD1306Display::transfer(const std::uint8_t *const framebuffer, const DirtyPages::Window &window)
+{
+    const std::uint8_t addressing[] = {
+        SSD1306_COLUMNADDR,
+        static_cast<std::uint8_t>(window.x1),
+        static_cast<std::uint8_t>(window.x2),
+        SSD1306_PAGEADDR,
+        static_cast<std::uint8_t>(window.firstPage),
+        static_cast<std::uint8_t>(window.lastPage),
+    };
+    wire->setClock(wireClk);
+    ssd1306_commandList(addressing, sizeof(addressing));
+    std::uint32_t bytesSent = 1 + sizeof(addressing);
+
+    // the controller continues in the next page of the window after the last column
+    std::size_t bytesInTransmission = 0;
+    for (auto page = window.firstPage; page <= window.lastPage; ++page)
+    {
+        const std::uint8_t *data = framebuffer + page * WIDTH + window.x1;
+        for (auto column = window.x1; column <= window.x2; ++column)
+        {
+            if (bytesInTransmission >= maxBytesPerTransmission)
+            {
+                wire->endTransmission();
+                bytesInTransmission = 0;
+            }
+            if (bytesInTransmission == 0)
+            {
+                wire->beginTransmission(i2caddr);
+                wire->write(controlByteData);
+                ++bytesInTransmission;
+                ++bytesSent;
+            }
+            wire->write(*data++);
+            ++bytesInTransmission;
+            ++bytesSent;
+        }
+    }
+    wire->endTransmission();
+    wire->setClock(restoreClk);
+    return bytesSent;
+}
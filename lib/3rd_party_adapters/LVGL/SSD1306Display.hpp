@@ -0,0 +1,44 @@
+#pragma once
+
+#include <Adafruit_SSD1306.h>
+#include <atomic>
+#include <cstdint>
+#include <display_interface/DirtyPages.hpp>
+#include <display_interface/IDisplayPanel.hpp>
+
+/**
+ * SSD1306 display which transfers only the changed parts of a frame buffer.
+ *
+ * Extends the Adafruit driver, which always transfers the whole frame buffer of its own.
+ * Only displays connected by I2C are supported.
+ */
+class SSD1306Display : public Adafruit_SSD1306, public IDisplayPanel
+{
+  public:
+    /**
+     * \param i2cClock clock frequency of the I2C bus in Hz
+     */
+    SSD1306Display(std::uint8_t width, std::uint8_t height, TwoWire *i2c, std::uint32_t i2cClock);
+
+    /**
+     * Transfers the changed windows of a frame buffer.
+     *
+     * Each window is addressed by the column and page address commands of the controller.
+     * Nothing is transferred if nothing has been changed.
+     */
+    virtual void transfer(const std::uint8_t *framebuffer, const DirtyPages &changes) override;
+
+    /**
+     * Fetches the number of bytes sent over I2C by transfer(), including commands.
+     *
+     * May be called from any task.
+     *
+     * \returns the bytes sent since the last call
+     */
+    std::uint32_t takeTransferredBytes();
+
+  private:
+    std::uint32_t transfer(const std::uint8_t *framebuffer, const DirtyPages::Window &window);
+
+    std::atomic<std::uint32_t> transferredBytes{0};
+};
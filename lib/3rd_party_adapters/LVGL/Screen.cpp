@@ -1,25 +1,201 @@
 #include "Screen.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <flat_map.hpp>
+#include <gauge.hpp>
 #include <math.h>
-#include <stack>
+#include <string_view>
+#include <vector>
 
-std::shared_ptr<IScreen> CurrentScreen;
-static std::stack<std::shared_ptr<IScreen>> screenHistory;
+ScreenHistory screenHistory;
+
+/**
+ * Styles shared by the objects of all screens.
+ *
+ * LVGL refers to the styles from the objects and caches their properties.
+ * Therefore they are set up only once and never changed afterwards.
+ */
+struct ScreenStyles
+{
+    lv_style_t smallPadding; ///< 1 px padding in all directions
+    lv_style_t noBorder;     ///< for containers which shall seem disabled
+};
+
+static const ScreenStyles *styles = nullptr;
+
+void createScreenStyles()
+{
+    static ScreenStyles registry;
+    if (styles)
+    {
+        return;
+    }
+
+    lv_style_init(&registry.smallPadding);
+    lv_style_set_pad_left(&registry.smallPadding, 1);
+    lv_style_set_pad_top(&registry.smallPadding, 1);
+    lv_style_set_pad_bottom(&registry.smallPadding, 1);
+    lv_style_set_pad_right(&registry.smallPadding, 1);
+
+    lv_style_init(&registry.noBorder);
+    lv_style_set_border_width(&registry.noBorder, 0);
+
+    styles = &registry;
+}
+
+/**
+ * Adds a shared style to the main part of an object.
+ *
+ * LVGL takes styles by non-const pointer, but only reads them.
+ */
+static inline void addStyle(lv_obj_t *const object, const lv_style_t &style)
+{
+    lv_obj_add_style(object, const_cast<lv_style_t *>(&style), 0);
+}
+
+/**
+ * \page menu_screen_cache Menu Screen Cache
+ *
+ * Building the LVGL objects of a menu takes long and fragments the LVGL heap.
+ * Therefore each menu is built once per item list and kept as an LVGL screen of its own.
+ * Entering a menu again only loads the cached screen and updates the widgets which show values.
+ * Each cached screen has its own focus group, so the focused item is kept as well.
+ *
+ * If the free LVGL heap falls below \ref reservedHeap, the least recently used screens are deleted.
+ * They are rebuilt when they are entered again.
+ */
+
+/**
+ * Free LVGL heap which shall remain for other objects when menus are cached.
+ */
+static constexpr std::size_t reservedHeap = LV_MEM_SIZE / 4;
+
+/**
+ * Widget which shows the value of a menu item.
+ */
+struct ValueWidget
+{
+    const IMenuItem *item;
+    lv_obj_t *widget; ///< the switch of a switch item, the value label of a value item
+};
+
+/**
+ * LVGL objects of a menu.
+ */
+struct CachedMenu
+{
+    lv_obj_t *screen;
+    lv_group_t *group;
+    std::vector<ValueWidget> values;
+    std::uint32_t lastUse; ///< for least recently used eviction
+};
+
+static FlatMap<const MenuItemList *, CachedMenu> cachedMenus;
+static std::uint32_t numberOfMenuLoads = 0;
+
+static Gauge navigationTime("menu navigation time", "us");
+static Gauge usedLvglHeap("LVGL heap used", "bytes");
+
+/**
+ * Makes a screen visible and lets the keys navigate in its focus group.
+ */
+static void showScreen(lv_obj_t *const screen, lv_group_t *const group)
+{
+    for (lv_indev_t *indev = lv_indev_get_next(nullptr); indev; indev = lv_indev_get_next(indev))
+    {
+        lv_indev_set_group(indev, group);
+    }
+    lv_scr_load(screen);
+}
+
+/**
+ * Deletes least recently used menus until enough LVGL heap is free.
+ *
+ * The visible screen is never deleted.
+ */
+static void evictMenus()
+{
+    lv_mem_monitor_t monitor;
+    lv_mem_monitor(&monitor);
+    while (monitor.free_size < reservedHeap)
+    {
+        auto leastRecentlyUsed = cachedMenus.end();
+        for (auto entry = cachedMenus.begin(); entry != cachedMenus.end(); ++entry)
+        {
+            if ((entry->second.screen != lv_scr_act()) &&
+                ((leastRecentlyUsed == cachedMenus.end()) || (entry->second.lastUse < leastRecentlyUsed->second.lastUse)))
+            {
+                leastRecentlyUsed = entry;
+            }
+        }
+        if (leastRecentlyUsed == cachedMenus.end())
+        {
+            return;
+        }
+        lv_obj_del(leastRecentlyUsed->second.screen);
+        lv_group_del(leastRecentlyUsed->second.group);
+        cachedMenus.erase(leastRecentlyUsed->first);
+        lv_mem_monitor(&monitor);
+    }
+}
+
+/**
+ * Updates the widgets of a menu to the current values of the items.
+ */
+static void refreshValues(const CachedMenu &menu)
+{
+    for (const auto &value : menu.values)
+    {
+        switch (value.item->getType())
+        {
+        case MenuItemType::SWITCH: {
+            if (static_cast<const MenuItemSwitch *>(value.item)->getValue())
+            {
+                lv_obj_add_state(value.widget, LV_STATE_CHECKED);
+            }
+            else
+            {
+                lv_obj_clear_state(value.widget, LV_STATE_CHECKED);
+            }
+            break;
+        }
+        case MenuItemType::VALUE: {
+            auto valItem = static_cast<const MenuItemValue *>(value.item);
+            lv_label_set_text_fmt(value.widget, "%.*f", valItem->getDecimals(), valItem->getValue());
+            break;
+        }
+        case MenuItemType::SUBMENU:
+        case MenuItemType::TASK_LIST:
+        case MenuItemType::DASHBOARD:
+            break;
+        }
+    }
+}
+
+/**
+ * Records the time needed to show a screen and the resulting heap usage of LVGL.
+ */
+static void measureNavigation(const std::chrono::steady_clock::time_point begin)
+{
+    const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin);
+    navigationTime.set(static_cast<std::uint32_t>(duration.count()));
+    lv_mem_monitor_t monitor;
+    lv_mem_monitor(&monitor);
+    usedLvglHeap.set(monitor.total_size - monitor.free_size);
+}
 
 static inline void IScreen_leave()
 {
     //only leave if we have something to go back to
-    if (screenHistory.size() > 0)
+    if (screenHistory.size() > 1)
     {
-        //clear the current screen of lvgl
-        lv_obj_clean(lv_scr_act());
-
-        //get previous screen
-        CurrentScreen = screenHistory.top();
-        //remove the previous screen from list
+        //remove the current screen from list
         screenHistory.pop();
 
         //draw the previous screen
-        CurrentScreen->draw();
+        screenHistory.top().draw();
     }
     else
     {
@@ -28,26 +204,46 @@ static inline void IScreen_leave()
 }
 
 /**
- * @brief Event callback function for an item that calls another submenu
- * @note  The lvgl event user data hold a pointer to the triggered submenu item
- * 
+ * @brief Shows a new screen on top of the current one
+ *
+ * @tparam Screen - type of the new screen
+ * @param argument - for the constructor of the new screen
+ */
+template <class Screen, class Argument>
+static inline void IScreen_enter(const Argument argument)
+{
+    //the current screen stays in the history
+    Screen *const screen = screenHistory.push<Screen>(argument);
+    if (screen)
+    {
+        screen->draw();
+    }
+    else
+    {
+        LV_LOG_WARN("Too many nested screens!");
+    }
+}
+
+/**
+ * @brief Event callback function for an item that opens another screen
+ * @note  The lvgl event user data hold a pointer to the triggered item
+ *
+ * @tparam Screen - type of the screen to be opened
+ * @tparam Item - type of the triggered item
+ * @tparam getArgument - member function of the item which returns the argument for the constructor of the screen
  * @param e - pointer to lvgl event object
  */
-static void ScreenMenu_submenu_cb(lv_event_t *e)
+template <class Screen, class Item, auto getArgument>
+static void ScreenMenu_enter_cb(lv_event_t *e)
 {
     lv_event_code_t code = lv_event_get_code(e);
-    lv_obj_t *obj = lv_event_get_target(e);
 
-    auto item = reinterpret_cast<const MenuItemSubmenu *const>(lv_event_get_user_data(e));
+    auto item = reinterpret_cast<const Item *const>(lv_event_get_user_data(e));
 
     if ((code == LV_EVENT_SHORT_CLICKED) && (item != nullptr))
     {
-        //save current screen in history
-        screenHistory.push(CurrentScreen);
-        //if we were clicked shortly, draw the next menu screen
-        lv_obj_clean(lv_scr_act());
-        CurrentScreen = std::make_shared<ScreenMenu>(*item->getSubMenuList());
-        CurrentScreen->draw();
+        //if we were clicked shortly, draw the screen of the item
+        IScreen_enter<Screen>((item->*getArgument)());
     }
     else if (code == LV_EVENT_KEY)
     {
@@ -75,11 +271,10 @@ static void ScreenMenu_switch_cb(lv_event_t *e)
 
     if ((code == LV_EVENT_VALUE_CHANGED) && (item != nullptr))
     {
-        //if we were clicked the switch, change the value of the original variable
-        bool *ptr = item->getPtrBool();
-        if (ptr)
+        //if we were clicked the switch, request to change the value of the original variable
+        if (item->hasVariable())
         {
-            *ptr = lv_obj_has_state(obj, LV_STATE_CHECKED) ? 1 : 0;
+            item->requestValue(lv_obj_has_state(obj, LV_STATE_CHECKED));
         }
     }
     else if (code == LV_EVENT_KEY)
@@ -108,11 +303,8 @@ static void ScreenMenu_value_cb(lv_event_t *e)
 
     if ((code == LV_EVENT_SHORT_CLICKED) && (item != nullptr))
     {
-        //save current screen in history
-        screenHistory.push(CurrentScreen);
         //if we were clicked shortly, draw the value modification screen
-        CurrentScreen = std::make_shared<ScreenValueModifier>(item);
-        CurrentScreen->draw();
+        IScreen_enter<ScreenValueModifier>(item);
     }
     else if (code == LV_EVENT_KEY)
     {
@@ -130,66 +322,80 @@ static void ScreenMenu_value_cb(lv_event_t *e)
  * 
  * @param itemList - List of items to be drawn with this menu
  */
-ScreenMenu::ScreenMenu(MenuItemList itemList)
+ScreenMenu::ScreenMenu(const MenuItemList *itemList)
     : _List{itemList}
 {
 }
 
 /**
- * @brief Translates the list of item types into actual lvgl draw directives.
+ * @brief Draws a button which opens the screen of an item
+ *
+ * @param screen - lvgl object the button is added to
+ * @param item - item shown by the button, passed to the callback as user data
+ * @param callback - opens the screen of the item and goes back on the back button, see ScreenMenu_enter_cb()
  */
-void ScreenMenu::draw()
+static void drawNavigationButton(lv_obj_t *const screen, const IMenuItem *const item, const lv_event_cb_t callback)
 {
-    /* clear the current displayed screen */
-    lv_obj_clean(lv_scr_act());
+    auto btn = lv_btn_create(screen);
+    lv_obj_set_size(btn, lv_pct(100), 12);
+    addStyle(btn, styles->smallPadding);
+    lv_obj_add_event_cb(btn, callback, LV_EVENT_SHORT_CLICKED, (void *)item); /* assign the callback for event short clicked */
+    lv_obj_add_event_cb(btn, callback, LV_EVENT_KEY, nullptr);                /* assign the callback for event key press */
+    auto lab = lv_label_create(btn);
+    lv_obj_set_width(lab, lv_pct(100));
+    lv_obj_set_align(lab, LV_ALIGN_LEFT_MID);
+    lv_label_set_long_mode(lab, LV_LABEL_LONG_SCROLL);
+    lv_label_set_text(lab, item->getText().c_str());
+}
 
-    /* adjust the style so everything has a 1 px padding in all directions */
-    static lv_style_t style_small_padding;
-    lv_style_init(&style_small_padding);
-    lv_style_set_pad_left(&style_small_padding, 1);
-    lv_style_set_pad_top(&style_small_padding, 1);
-    lv_style_set_pad_bottom(&style_small_padding, 1);
-    lv_style_set_pad_right(&style_small_padding, 1);
+/**
+ * @brief Translates the list of item types into actual lvgl draw directives.
+ *
+ * @param itemList - items of the menu
+ * @returns the objects of the menu
+ */
+static CachedMenu buildMenu(const MenuItemList &itemList)
+{
+    CachedMenu menu{.screen = nullptr, .group = lv_group_create(), .values = {}, .lastUse = 0};
+    /* the widgets are added to the default group on creation */
+    lv_group_t *const previousDefaultGroup = lv_group_get_default();
+    lv_group_set_default(menu.group);
 
     /* create the lvgl screen object and configure it's properties */
     lv_obj_t *screen = lv_obj_create(NULL);
-    lv_obj_add_style(screen, &style_small_padding, 0);
+    menu.screen = screen;
+    addStyle(screen, styles->smallPadding);
     lv_obj_set_flex_flow(screen, LV_FLEX_FLOW_COLUMN);
     lv_obj_set_style_pad_row(screen, 2, 0);
     lv_obj_set_flex_align(screen, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER);
     lv_obj_set_scrollbar_mode(screen, LV_SCROLLBAR_MODE_OFF);
 
     /* draw each item */
-    for (auto const &item : this->_List)
+    for (auto const &item : itemList)
     {
         switch (item->getType())
         {
         case MenuItemType::SUBMENU: {
             /* draw submenu button */
-            auto btnItem = reinterpret_cast<const MenuItemSubmenu *const>(item);
-            auto btn = lv_btn_create(screen);
-            lv_obj_set_size(btn, lv_pct(100), 12);
-            lv_obj_add_style(btn, &style_small_padding, 0);
-            lv_obj_add_event_cb(btn, ScreenMenu_submenu_cb, LV_EVENT_SHORT_CLICKED, (void *)item); /* assign the submenu callback for event short clicked */
-            lv_obj_add_event_cb(btn, ScreenMenu_submenu_cb, LV_EVENT_KEY, nullptr);                /* assign the submenu callback for event key press */
-            auto lab = lv_label_create(btn);
-            lv_obj_set_width(lab, lv_pct(100));
-            lv_obj_set_align(lab, LV_ALIGN_LEFT_MID);
-            lv_label_set_long_mode(lab, LV_LABEL_LONG_SCROLL);
-            lv_label_set_text(lab, item->getText().c_str());
+            drawNavigationButton(screen, item, ScreenMenu_enter_cb<ScreenMenu, MenuItemSubmenu, &MenuItemSubmenu::getSubMenuList>);
+            break;
+        }
+        case MenuItemType::TASK_LIST: {
+            /* draw button which opens the task list */
+            drawNavigationButton(screen, item, ScreenMenu_enter_cb<ScreenTaskList, MenuItemTaskList, &MenuItemTaskList::getWindow>);
+            break;
+        }
+        case MenuItemType::DASHBOARD: {
+            /* draw button which opens the dashboard */
+            drawNavigationButton(screen, item, ScreenMenu_enter_cb<ScreenDashboard, MenuItemDashboard, &MenuItemDashboard::getDashboard>);
             break;
         }
         case MenuItemType::SWITCH: {
-            /* create style without border for disabled switch container */
-            static lv_style_t style_no_border;
-            lv_style_init(&style_no_border);
-            lv_style_set_border_width(&style_no_border, 0);
-
             /* draw switch */
             auto swtItem = reinterpret_cast<const MenuItemSwitch *const>(item);
             auto cont = lv_obj_create(screen);
             lv_obj_set_size(cont, lv_pct(100), 12);
-            lv_obj_add_style(cont, &style_small_padding, 0);
+            addStyle(cont, styles->smallPadding);
             lv_obj_set_scrollbar_mode(cont, LV_SCROLLBAR_MODE_OFF);
             lv_obj_add_flag(cont, LV_OBJ_FLAG_OVERFLOW_VISIBLE);
             auto lab = lv_label_create(cont);
@@ -201,19 +407,18 @@ void ScreenMenu::draw()
             lv_obj_set_size(swth, 18, 12);
             lv_obj_set_align(swth, LV_ALIGN_RIGHT_MID);
 
-            bool *ptr = swtItem->getPtrBool();
-            if (ptr == nullptr)
+            if (!swtItem->hasVariable())
             {
                 /* if pointer to bool variable is not valid, disable the switch and don't add callbacks */
                 lv_obj_add_state(swth, LV_STATE_DISABLED);
 
                 /* change style so container seems disabled as well */
-                lv_obj_add_style(cont, &style_no_border, 0);
+                addStyle(cont, styles->noBorder);
             }
             else
             {
                 /* if pointer to bool variable is valid, show it's state and assign callbacks */
-                lv_obj_add_state(swth, (*ptr) ? LV_STATE_CHECKED : LV_STATE_DEFAULT);
+                menu.values.push_back({.item = item, .widget = swth});
                 lv_obj_add_event_cb(swth, ScreenMenu_switch_cb, LV_EVENT_VALUE_CHANGED, (void *)item); /* assign the switch callback for event value change*/
                 lv_obj_add_event_cb(swth, ScreenMenu_switch_cb, LV_EVENT_KEY, nullptr);                /* assign the switch callback for event key press */
             }
@@ -224,7 +429,7 @@ void ScreenMenu::draw()
             auto valItem = reinterpret_cast<const MenuItemValue *const>(item);
             auto btn = lv_btn_create(screen);
             lv_obj_set_size(btn, lv_pct(100), 12);
-            lv_obj_add_style(btn, &style_small_padding, 0);
+            addStyle(btn, styles->smallPadding);
             auto lab = lv_label_create(btn);
             lv_obj_set_width(lab, lv_pct(70));
             lv_obj_set_align(lab, LV_ALIGN_LEFT_MID);
@@ -236,8 +441,7 @@ void ScreenMenu::draw()
             lv_label_set_long_mode(lab, LV_LABEL_LONG_SCROLL);
             lv_obj_set_style_text_align(lab, LV_TEXT_ALIGN_RIGHT, 0);
 
-            double *ptr = valItem->getPtrDouble();
-            if (ptr == nullptr)
+            if (!valItem->hasVariable())
             {
                 /* if pointer to double variable is not valid, disable the switch and don't add callbacks */
                 lv_obj_add_state(btn, LV_STATE_DISABLED);
@@ -246,7 +450,7 @@ void ScreenMenu::draw()
             else
             {
                 /* if pointer to double variable is valid, show it's value and assign callbacks */
-                lv_label_set_text_fmt(lab, "%.*f", valItem->getDecimals(), *valItem->getPtrDouble());
+                menu.values.push_back({.item = item, .widget = lab});
                 lv_obj_add_event_cb(btn, ScreenMenu_value_cb, LV_EVENT_SHORT_CLICKED, (void *)item); /* assign the value callback for event short clicked */
                 lv_obj_add_event_cb(btn, ScreenMenu_value_cb, LV_EVENT_KEY, nullptr);                /* assign the value callback for event key press */
             }
@@ -255,8 +459,28 @@ void ScreenMenu::draw()
         }
     }
 
+    lv_group_set_default(previousDefaultGroup);
+    return menu;
+}
+
+void ScreenMenu::draw()
+{
+    const auto begin = std::chrono::steady_clock::now();
+    auto cached = cachedMenus.find(_List);
+    if (cached == cachedMenus.end())
+    {
+        evictMenus();
+        cached = cachedMenus.try_emplace(_List, buildMenu(*_List)).first;
+    }
+    CachedMenu &menu = cached->second;
+    menu.lastUse = ++numberOfMenuLoads;
+
+    /* the values may have been changed while the menu has not been visible */
+    refreshValues(menu);
+
     /* actually draw the screen with lvgl */
-    lv_scr_load(screen);
+    showScreen(menu.screen, menu.group);
+    measureNavigation(begin);
 }
 
 /**
@@ -359,9 +583,8 @@ static void ScreenValueModifier_valueChange_cb(lv_event_t *e)
 
     if ((code == LV_EVENT_VALUE_CHANGED) && (screen != nullptr) && (screen->_menuItem != nullptr) && (screen->_spinbox != nullptr))
     {
-        //if we changed the value of the spinbox, write it according the decimals to the source variable.
-        auto ptr = screen->_menuItem->getPtrDouble();
-        *ptr = ((double)lv_spinbox_get_value(screen->_spinbox)) / std::pow(10, screen->_menuItem->getDecimals());
+        //if we changed the value of the spinbox, request to write it according the decimals to the source variable.
+        screen->_menuItem->requestValue(((double)lv_spinbox_get_value(screen->_spinbox)) / std::pow(10, screen->_menuItem->getDecimals()));
     }
     else if (code == LV_EVENT_KEY)
     {
@@ -385,40 +608,58 @@ ScreenValueModifier::ScreenValueModifier(const MenuItemValue *const menuItem)
 {
 }
 
+/**
+ * @brief Deletes the objects of a screen and its focus group.
+ *
+ * @param screen - screen object whose user data is the focus group
+ */
+static void deleteScreen(void *screen)
+{
+    auto group = static_cast<lv_group_t *>(lv_obj_get_user_data(static_cast<lv_obj_t *>(screen)));
+    lv_obj_del(static_cast<lv_obj_t *>(screen));
+    lv_group_del(group);
+}
+
+ScreenValueModifier::~ScreenValueModifier()
+{
+    if (_screen)
+    {
+        // the screen may be destroyed within the event callback of one of its objects
+        lv_async_call(deleteScreen, _screen);
+    }
+}
+
 /**
  * @brief Draws a new screen, with a spinbox and 3 buttons for incrementation, decrementation and step modification.
  */
 void ScreenValueModifier::draw()
 {
+    const auto begin = std::chrono::steady_clock::now();
     lv_obj_t *btn;
     lv_obj_t *lab;
 
-    /* clear the current displayed screen */
-    lv_obj_clean(lv_scr_act());
-
-    /* adjust the style so everything has a 1 px padding in all directions */
-    static lv_style_t style_small_padding;
-    lv_style_init(&style_small_padding);
-    lv_style_set_pad_left(&style_small_padding, 1);
-    lv_style_set_pad_top(&style_small_padding, 1);
-    lv_style_set_pad_bottom(&style_small_padding, 1);
-    lv_style_set_pad_right(&style_small_padding, 1);
+    /* the widgets are added to the default group on creation */
+    lv_group_t *const group = lv_group_create();
+    lv_group_t *const previousDefaultGroup = lv_group_get_default();
+    lv_group_set_default(group);
 
     /* create the lvgl screen object and configure it's properties */
     lv_obj_t *screen = lv_obj_create(NULL);
-    lv_obj_add_style(screen, &style_small_padding, 0);
+    _screen = screen;
+    lv_obj_set_user_data(screen, group);
+    addStyle(screen, styles->smallPadding);
 
     /* draw spinbox */
     _spinbox = lv_spinbox_create(screen);
     lv_group_remove_obj(_spinbox); //remove the spinbox from being selectable by default
     lv_obj_set_width(_spinbox, lv_pct(55));
-    lv_obj_add_style(_spinbox, &style_small_padding, 0);
+    addStyle(_spinbox, styles->smallPadding);
     lv_obj_center(_spinbox);
     lv_spinbox_set_digit_format(_spinbox, 7, (7 - _menuItem->getDecimals()));
     int32_t min = ((_menuItem->getMin()) * std::pow(10, _menuItem->getDecimals()));
     int32_t max = ((_menuItem->getMax()) * std::pow(10, _menuItem->getDecimals()));
     lv_spinbox_set_range(_spinbox, min, max);
-    int32_t val = ((*_menuItem->getPtrDouble()) * std::pow(10, _menuItem->getDecimals()));
+    int32_t val = std::lround(_menuItem->getValue() * std::pow(10, _menuItem->getDecimals()));
     lv_spinbox_set_value(_spinbox, val);
     lv_obj_add_event_cb(_spinbox, ScreenValueModifier_valueChange_cb, LV_EVENT_VALUE_CHANGED, (void *)this);
     lv_obj_add_event_cb(_spinbox, ScreenValueModifier_valueChange_cb, LV_EVENT_KEY, nullptr);
@@ -428,7 +669,7 @@ void ScreenValueModifier::draw()
     /* draw incrementation button */
     btn = lv_btn_create(screen);
     lv_obj_set_size(btn, h, h);
-    lv_obj_add_style(btn, &style_small_padding, 0);
+    addStyle(btn, styles->smallPadding);
     lv_obj_align_to(btn, _spinbox, LV_ALIGN_OUT_RIGHT_MID, 2, 0);
     lv_obj_add_event_cb(btn, ScreenValueModifier_inc_cb, LV_EVENT_LONG_PRESSED_REPEAT, _spinbox);
     lv_obj_add_event_cb(btn, ScreenValueModifier_inc_cb, LV_EVENT_SHORT_CLICKED, _spinbox);
@@ -440,7 +681,7 @@ void ScreenValueModifier::draw()
     /* draw decrementation button */
     btn = lv_btn_create(screen);
     lv_obj_set_size(btn, h, h);
-    lv_obj_add_style(btn, &style_small_padding, 0);
+    addStyle(btn, styles->smallPadding);
     lv_obj_align_to(btn, _spinbox, LV_ALIGN_OUT_LEFT_MID, -2, 0);
     lv_obj_add_event_cb(btn, ScreenValueModifier_dec_cb, LV_EVENT_LONG_PRESSED_REPEAT, _spinbox);
     lv_obj_add_event_cb(btn, ScreenValueModifier_dec_cb, LV_EVENT_SHORT_CLICKED, _spinbox);
@@ -452,7 +693,7 @@ void ScreenValueModifier::draw()
     /* draw step modification button */
     btn = lv_btn_create(screen);
     lv_obj_set_size(btn, 10, 10);
-    lv_obj_add_style(btn, &style_small_padding, 0);
+    addStyle(btn, styles->smallPadding);
     lv_obj_align_to(btn, _spinbox, LV_ALIGN_OUT_BOTTOM_MID, 0, 2);
     lv_obj_add_event_cb(btn, ScreenValueModifier_step_cb, LV_EVENT_LONG_PRESSED_REPEAT, _spinbox);
     lv_obj_add_event_cb(btn, ScreenValueModifier_step_cb, LV_EVENT_SHORT_CLICKED, _spinbox);
@@ -461,6 +702,411 @@ void ScreenValueModifier::draw()
     lv_label_set_text_static(lab, "*");
     lv_obj_set_align(lab, LV_ALIGN_CENTER);
 
+    lv_group_set_default(previousDefaultGroup);
+
     /* actually draw the screen with lvgl */
-    lv_scr_load(screen);
+    showScreen(screen, group);
+    measureNavigation(begin);
+}
+
+/**
+ * Interval in which the screen checks whether the window has delivered rows.
+ */
+static constexpr std::uint32_t taskListPollPeriod = 50; // ms
+
+/**
+ * @brief Timer callback which shows the rows delivered by the window
+ * @note  The timer user data hold a pointer to the task list screen
+ *
+ * @param timer - pointer to lvgl timer object
+ */
+static void ScreenTaskList_poll_cb(lv_timer_t *timer)
+{
+    auto screen = static_cast<ScreenTaskList *>(timer->user_data);
+    if (const auto page = screen->_window->takePage())
+    {
+        screen->showPage(*page);
+    }
+}
+
+/**
+ * @brief Event callback function for a row of the task list
+ * @note  The lvgl event user data hold a pointer to the task list screen
+ *
+ * @param e - pointer to lvgl event object
+ */
+static void ScreenTaskList_row_cb(lv_event_t *e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t *obj = lv_event_get_target(e);
+
+    auto screen = static_cast<ScreenTaskList *>(lv_event_get_user_data(e));
+
+    if ((code == LV_EVENT_FOCUSED) && (screen != nullptr))
+    {
+        //the rows are the only children of the screen, in their order
+        screen->select(lv_obj_get_index(obj));
+    }
+    else if (code == LV_EVENT_KEY)
+    {
+        uint32_t key = lv_event_get_key(e);
+        if (key == LV_KEY_ESC)
+        {
+            //if we receive the back button, go one screen back
+            IScreen_leave();
+        }
+    }
+}
+
+/**
+ * @brief Construct a new ScreenTaskList object
+ *
+ * @param window - provides the rows of the tasks to show
+ */
+ScreenTaskList::ScreenTaskList(TaskListWindow *const window)
+    : _window{window}
+{
+}
+
+ScreenTaskList::~ScreenTaskList()
+{
+    _window->close();
+    if (_timer)
+    {
+        lv_timer_del(_timer);
+    }
+    if (_screen)
+    {
+        // the screen may be destroyed within the event callback of one of its objects
+        lv_async_call(deleteScreen, _screen);
+    }
+}
+
+/**
+ * @brief Draws a new screen with a fixed number of rows, whose content is filled in by showPage()
+ */
+void ScreenTaskList::draw()
+{
+    if (_screen)
+    {
+        showScreen(_screen, static_cast<lv_group_t *>(lv_obj_get_user_data(_screen)));
+        return;
+    }
+    const auto begin = std::chrono::steady_clock::now();
+
+    /* the rows are added to the default group on creation */
+    lv_group_t *const group = lv_group_create();
+    lv_group_t *const previousDefaultGroup = lv_group_get_default();
+    lv_group_set_default(group);
+    // scrolling beyond the first or last row is done by requesting other rows
+    lv_group_set_wrap(group, false);
+
+    /* create the lvgl screen object and configure it's properties */
+    lv_obj_t *screen = lv_obj_create(NULL);
+    _screen = screen;
+    lv_obj_set_user_data(screen, group);
+    addStyle(screen, styles->smallPadding);
+    lv_obj_set_flex_flow(screen, LV_FLEX_FLOW_COLUMN);
+    lv_obj_set_style_pad_row(screen, 2, 0);
+    lv_obj_set_scrollbar_mode(screen, LV_SCROLLBAR_MODE_OFF);
+
+    /* draw the rows, which are hidden until rows have been delivered */
+    for (std::size_t row = 0; row < TaskListWindow::visibleRows; ++row)
+    {
+        auto btn = lv_btn_create(screen);
+        _rows[row] = btn;
+        lv_obj_set_size(btn, lv_pct(100), 10);
+        addStyle(btn, styles->smallPadding);
+        lv_obj_set_flex_flow(btn, LV_FLEX_FLOW_ROW);
+        lv_obj_add_event_cb(btn, ScreenTaskList_row_cb, LV_EVENT_FOCUSED, this);
+        lv_obj_add_event_cb(btn, ScreenTaskList_row_cb, LV_EVENT_KEY, nullptr);
+
+        auto lab = lv_label_create(btn);
+        _labels[row] = lab;
+        lv_obj_set_flex_grow(lab, 1);
+        // a single line; LV_LABEL_LONG_DOT would write the dots into the static text of the page
+        lv_obj_set_height(lab, lv_pct(100));
+        lv_label_set_long_mode(lab, LV_LABEL_LONG_CLIP);
+        lv_label_set_text_static(lab, "");
+
+        lab = lv_label_create(btn);
+        _durationLabels[row] = lab;
+        lv_label_set_text_static(lab, "");
+
+        if (row > 0)
+        {
+            lv_obj_add_flag(btn, LV_OBJ_FLAG_HIDDEN);
+        }
+    }
+
+    lv_group_set_default(previousDefaultGroup);
+
+    _timer = lv_timer_create(ScreenTaskList_poll_cb, taskListPollPeriod, this);
+    // a page delivered to a previous task list would be shown instead of the requested one
+    _window->takePage();
+    _window->request(0);
+
+    /* actually draw the screen with lvgl */
+    showScreen(screen, group);
+    measureNavigation(begin);
+}
+
+void ScreenTaskList::showPage(const TaskListWindow::Page &page)
+{
+    _page = page;
+    for (std::size_t row = 0; row < TaskListWindow::visibleRows; ++row)
+    {
+        if (row < _page.numberOfRows)
+        {
+            const auto &content = _page.rows[row];
+            const auto minutes = content.duration.count();
+            std::snprintf(_durations[row].data(), _durations[row].size(), "%s%ld:%02ld", content.isRunning ? ">" : "",
+                          static_cast<long>(minutes / 60), static_cast<long>(minutes % 60));
+            lv_label_set_text_static(_labels[row], content.label.c_str());
+            lv_label_set_text_static(_durationLabels[row], _durations[row].data());
+            lv_obj_clear_flag(_rows[row], LV_OBJ_FLAG_HIDDEN);
+        }
+        else if (row == 0)
+        {
+            // keep one row, so the screen can be left
+            lv_label_set_text_static(_labels[row], "no tasks");
+            lv_label_set_text_static(_durationLabels[row], "");
+        }
+        else
+        {
+            lv_obj_add_flag(_rows[row], LV_OBJ_FLAG_HIDDEN);
+        }
+    }
+
+    // keep the selected task focused, also if it is shown in another row now
+    const std::size_t lastShown = _page.first + std::max<std::size_t>(_page.numberOfRows, 1) - 1;
+    _selected = std::clamp(_selected, _page.first, lastShown);
+    lv_group_focus_obj(_rows[_selected - _page.first]);
+}
+
+void ScreenTaskList::select(const std::size_t row)
+{
+    _selected = _page.first + row;
+
+    // keep a neighbour of the selected row visible, so the selection can move on
+    std::size_t first = _page.first;
+    if ((row + 1 >= TaskListWindow::visibleRows) && (_selected + 1 < _page.numberOfTasks))
+    {
+        first = _selected + 2 - TaskListWindow::visibleRows;
+    }
+    else if ((row == 0) && (_selected > 0))
+    {
+        first = _selected - 1;
+    }
+
+    if (first != _page.first)
+    {
+        _window->request(first);
+    }
+}
+
+/**
+ * Interval in which the dashboard is updated.
+ */
+static constexpr std::uint32_t dashboardUpdatePeriod = 1000; // ms
+
+/**
+ * Height of a row of the dashboard.
+ */
+static constexpr lv_coord_t dashboardRowHeight = 12;
+
+/**
+ * Shows a text from a buffer of the screen.
+ *
+ * LVGL redraws a label whenever its text is set, thus the text is only set if it has changed.
+ *
+ * @param label - label showing the buffer
+ * @param shown - buffer shown by the label
+ * @param text - text to show
+ */
+template <std::size_t Capacity>
+static void setTextIfChanged(lv_obj_t *const label, InlineString<Capacity> &shown, const std::string_view text)
+{
+    if (shown == text)
+    {
+        return;
+    }
+    shown.assign(text);
+    lv_label_set_text_static(label, shown.c_str());
+}
+
+/**
+ * Hides or shows an object, without redrawing it if nothing changes.
+ */
+static void setHidden(lv_obj_t *const object, const bool hidden)
+{
+    if (lv_obj_has_flag(object, LV_OBJ_FLAG_HIDDEN) == hidden)
+    {
+        return;
+    }
+    if (hidden)
+    {
+        lv_obj_add_flag(object, LV_OBJ_FLAG_HIDDEN);
+    }
+    else
+    {
+        lv_obj_clear_flag(object, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+/**
+ * @brief Timer callback which updates the dashboard
+ * @note  The timer user data hold a pointer to the dashboard screen
+ *
+ * @param timer - pointer to lvgl timer object
+ */
+static void ScreenDashboard_update_cb(lv_timer_t *timer)
+{
+    static_cast<ScreenDashboard *>(timer->user_data)->update();
+}
+
+/**
+ * @brief Event callback function for the dashboard screen
+ *
+ * @param e - pointer to lvgl event object
+ */
+static void ScreenDashboard_key_cb(lv_event_t *e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+
+    if (code == LV_EVENT_KEY)
+    {
+        uint32_t key = lv_event_get_key(e);
+        if (key == LV_KEY_ESC)
+        {
+            //if we receive the back button, go one screen back
+            IScreen_leave();
+        }
+    }
+}
+
+/**
+ * @brief Construct a new ScreenDashboard object
+ *
+ * @param dashboard - provides the running tasks
+ */
+ScreenDashboard::ScreenDashboard(TaskDashboard *const dashboard)
+    : _dashboard{dashboard}
+{
+}
+
+ScreenDashboard::~ScreenDashboard()
+{
+    if (_timer)
+    {
+        lv_timer_del(_timer);
+    }
+    if (_screen)
+    {
+        // the screen may be destroyed within the event callback of one of its objects
+        lv_async_call(deleteScreen, _screen);
+    }
+}
+
+/**
+ * @brief Draws a new screen with a label for the name and one for the duration of each row
+ */
+void ScreenDashboard::draw()
+{
+    if (_screen)
+    {
+        showScreen(_screen, static_cast<lv_group_t *>(lv_obj_get_user_data(_screen)));
+        return;
+    }
+    const auto begin = std::chrono::steady_clock::now();
+
+    /* create the lvgl screen object and configure it's properties */
+    lv_obj_t *screen = lv_obj_create(NULL);
+    _screen = screen;
+    lv_obj_clear_flag(screen, LV_OBJ_FLAG_SCROLLABLE);
+
+    /* the screen itself receives the keys, as there is nothing to select */
+    lv_group_t *const group = lv_group_create();
+    lv_obj_set_user_data(screen, group);
+    lv_group_add_obj(group, screen);
+    lv_obj_add_event_cb(screen, ScreenDashboard_key_cb, LV_EVENT_KEY, nullptr);
+
+    /* draw the rows, which are hidden until a snapshot has been delivered */
+    for (std::size_t row = 0; row < TaskDashboard::maximumRows; ++row)
+    {
+        const lv_coord_t y = static_cast<lv_coord_t>(row) * dashboardRowHeight;
+
+        auto lab = lv_label_create(screen);
+        _labels[row] = lab;
+        lv_obj_set_pos(lab, 0, y);
+        // a single line; LV_LABEL_LONG_DOT would write the dots into the static text of the row
+        lv_obj_set_size(lab, lv_pct(50), dashboardRowHeight);
+        lv_label_set_long_mode(lab, LV_LABEL_LONG_CLIP);
+        lv_label_set_text_static(lab, _labelTexts[row].c_str());
+        lv_obj_add_flag(lab, LV_OBJ_FLAG_HIDDEN);
+
+        lab = lv_label_create(screen);
+        _durationLabels[row] = lab;
+        lv_obj_align(lab, LV_ALIGN_TOP_RIGHT, 0, y);
+        lv_label_set_text_static(lab, _durationTexts[row].c_str());
+        lv_obj_add_flag(lab, LV_OBJ_FLAG_HIDDEN);
+    }
+
+    // discard a snapshot which has been requested by a previous dashboard
+    _dashboard->takeSnapshot();
+    _dashboard->request();
+    // the first snapshot is shown as soon as it has been delivered
+    _timer = lv_timer_create(ScreenDashboard_update_cb, taskListPollPeriod, this);
+
+    /* actually draw the screen with lvgl */
+    showScreen(screen, group);
+    measureNavigation(begin);
+}
+
+void ScreenDashboard::update()
+{
+    if (auto snapshot = _dashboard->takeSnapshot())
+    {
+        if (!_snapshot)
+        {
+            lv_timer_set_period(_timer, dashboardUpdatePeriod);
+        }
+        _snapshot = snapshot;
+        // the snapshot may have been waiting in the queue since the previous update
+        const auto age = std::chrono::duration_cast<std::chrono::milliseconds>(Task::Clock::now() - snapshot->sampledAt);
+        _snapshotTick = lv_tick_get() - static_cast<std::uint32_t>(std::max<std::chrono::milliseconds::rep>(age.count(), 0));
+    }
+    _dashboard->request();
+    if (!_snapshot)
+    {
+        return;
+    }
+
+    const auto passed = std::chrono::duration_cast<Task::Duration>(std::chrono::milliseconds(lv_tick_elaps(_snapshotTick)));
+    for (std::size_t row = 0; row < TaskDashboard::maximumRows; ++row)
+    {
+        if (row < _snapshot->numberOfRows)
+        {
+            const auto &content = _snapshot->rows[row];
+            const auto seconds = (content.duration + passed).count();
+            char duration[DurationText::capacity() + 1];
+            std::snprintf(duration, sizeof(duration), "%ld:%02ld:%02ld", static_cast<long>(seconds / 3600),
+                          static_cast<long>((seconds / 60) % 60), static_cast<long>(seconds % 60));
+            setTextIfChanged(_labels[row], _labelTexts[row], content.label);
+            setTextIfChanged(_durationLabels[row], _durationTexts[row], duration);
+            setHidden(_labels[row], false);
+            setHidden(_durationLabels[row], false);
+        }
+        else if (row == 0)
+        {
+            setTextIfChanged(_labels[row], _labelTexts[row], "no task");
+            setHidden(_labels[row], false);
+            setHidden(_durationLabels[row], true);
+        }
+        else
+        {
+            setHidden(_labels[row], true);
+            setHidden(_durationLabels[row], true);
+        }
+    }
 }
@@ -4,9 +4,22 @@
  */
 #pragma once
 
+#include <array>
+#include <inline_string.hpp>
+#include <inplace_stack.hpp>
 #include <lvgl.h>
-#include <memory>
+#include <optional>
 #include <user_interaction/MenuItem.hpp>
+#include <user_interaction/TaskDashboard.hpp>
+#include <user_interaction/TaskListWindow.hpp>
+
+/**
+ * Sets up the styles which are shared by all screens.
+ *
+ * Must be called after LVGL has been initialized and before the first screen is drawn.
+ * Further calls have no effect.
+ */
+void createScreenStyles();
 
 /**
  * @brief Interface class for Screen objects
@@ -29,13 +42,18 @@ class IScreen
 class ScreenMenu final : public IScreen
 {
   public:
-    ScreenMenu(MenuItemList itemList);
+    ScreenMenu(const MenuItemList *itemList);
     ~ScreenMenu() override = default;
 
+    /**
+     * Shows the menu.
+     *
+     * The LVGL objects of a menu are built once and cached; see \ref menu_screen_cache.
+     */
     void draw() override;
 
   private:
-    const MenuItemList _List;
+    const MenuItemList *const _List;
 };
 
 /**
@@ -46,12 +64,130 @@ class ScreenValueModifier final : public IScreen
 {
   public:
     ScreenValueModifier(const MenuItemValue *const menuItem);
-    ~ScreenValueModifier() override = default;
+
+    /**
+     * Deletes the LVGL objects of the screen once LVGL has finished processing the current event.
+     */
+    ~ScreenValueModifier() override;
 
     void draw() override;
 
     const MenuItemValue *const _menuItem;
-    lv_obj_t *_spinbox;
+    lv_obj_t *_spinbox = nullptr;
+
+  private:
+    lv_obj_t *_screen = nullptr;
 };
 
-extern std::shared_ptr<IScreen> CurrentScreen;
\ No newline at end of file
+/**
+ * @brief Screen listing all tasks
+ *
+ * Only the visible rows exist as LVGL objects, so the LVGL heap used does not depend on the number of tasks.
+ * When the selection reaches the first or last row, the neighbouring rows are requested from the window
+ * and the content of the row objects is replaced once they have been delivered.
+ */
+class ScreenTaskList final : public IScreen
+{
+  public:
+    ScreenTaskList(TaskListWindow *const window);
+
+    /**
+     * Closes the window and deletes the LVGL objects of the screen once LVGL has finished processing the current event.
+     */
+    ~ScreenTaskList() override;
+
+    void draw() override;
+
+    /**
+     * Shows the rows which have been delivered by the window.
+     */
+    void showPage(const TaskListWindow::Page &page);
+
+    /**
+     * Requests further rows, if a row at the border has been selected.
+     *
+     * \param row index of the row object which has been focused
+     */
+    void select(const std::size_t row);
+
+    TaskListWindow *const _window;
+
+  private:
+    /**
+     * Text of a duration in hours and minutes, with a mark for running tasks.
+     */
+    typedef std::array<char, 12> DurationText;
+
+    lv_obj_t *_screen = nullptr;
+    lv_timer_t *_timer = nullptr;
+
+    /**
+     * The labels show the texts of the page and the durations without copying them.
+     */
+    TaskListWindow::Page _page{};
+    std::array<DurationText, TaskListWindow::visibleRows> _durations{};
+
+    std::array<lv_obj_t *, TaskListWindow::visibleRows> _rows{};
+    std::array<lv_obj_t *, TaskListWindow::visibleRows> _labels{};
+    std::array<lv_obj_t *, TaskListWindow::visibleRows> _durationLabels{};
+
+    std::size_t _selected = 0; ///< index of the selected task within all tasks
+};
+
+/**
+ * @brief Screen showing the running tasks and their elapsed time
+ *
+ * A single LVGL timer updates the screen once per second.
+ * The labels show the texts of buffers of the screen, which are only written, and the labels only redrawn,
+ * if the text has changed. Thus usually only the seconds of the running tasks are redrawn.
+ */
+class ScreenDashboard final : public IScreen
+{
+  public:
+    ScreenDashboard(TaskDashboard *const dashboard);
+
+    /**
+     * Deletes the LVGL objects of the screen once LVGL has finished processing the current event.
+     */
+    ~ScreenDashboard() override;
+
+    void draw() override;
+
+    /**
+     * Shows the latest snapshot, advanced by the time passed since it has been sampled, and requests the next one.
+     */
+    void update();
+
+    TaskDashboard *const _dashboard;
+
+  private:
+    typedef InlineString<15> DurationText;
+
+    lv_obj_t *_screen = nullptr;
+    lv_timer_t *_timer = nullptr;
+
+    std::optional<TaskDashboard::Snapshot> _snapshot;
+    std::uint32_t _snapshotTick = 0; ///< LVGL tick when the snapshot has been sampled
+
+    std::array<Task::String, TaskDashboard::maximumRows> _labelTexts{};
+    std::array<DurationText, TaskDashboard::maximumRows> _durationTexts{};
+    std::array<lv_obj_t *, TaskDashboard::maximumRows> _labels{};
+    std::array<lv_obj_t *, TaskDashboard::maximumRows> _durationLabels{};
+};
+
+/**
+ * Maximum number of nested screens.
+ *
+ * The main menu, a submenu, a nested submenu and a screen to change a value or to show tasks.
+ * Menus may refer to each other in cycles; entering more screens is refused.
+ * Each level takes a slot of the size of the largest screen, so the depth is kept at what is really used.
+ */
+constexpr std::size_t maxScreenDepth = 4;
+
+/**
+ * Screens which have been entered; the screen on top is the visible one.
+ *
+ * The screens are stored within the stack, so navigating does not allocate memory.
+ */
+typedef InplaceStack<IScreen, maxScreenDepth, ScreenMenu, ScreenValueModifier, ScreenTaskList, ScreenDashboard> ScreenHistory;
+extern ScreenHistory screenHistory;
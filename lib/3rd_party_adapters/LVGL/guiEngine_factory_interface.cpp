@@ -1,11 +1,17 @@
 #include "GuiEngine.hpp"
+#include "GuiTask.hpp"
 #include <Arduino.h>
 #include <board_pins.hpp>
 #include <user_interaction/guiEngine_factory_interface.hpp>
 
-namespace board
-{
-IGuiEngine &getGuiEngine()
+/**
+ * Creates the LVGL engine.
+ *
+ * Is called in the context of the GUI task, which is the only one to use the display and LVGL.
+ *
+ * \returns the engine
+ */
+static IGuiEngine &createGuiEngine()
 {
     Wire.begin(board::i2c_1::pin::sda, board::i2c_1::pin::scl);
     constexpr GuiEngine::Configuration configuration = {
@@ -13,8 +19,23 @@ IGuiEngine &getGuiEngine()
         .screen_height = 64,
         .generateDisplayVoltageInternally = true,
         .display_i2c_address = 0x3D,
+        .i2cClock = 400'000, // fast mode, as specified by the SSD1306 data sheet
     };
     static GuiEngine singleton(configuration, Wire);
     return singleton;
 }
+
+namespace board
+{
+IGuiEngine &getGuiEngine()
+{
+    // the application runs on the other core, see ARDUINO_RUNNING_CORE
+    constexpr GuiTask::Configuration configuration = {
+        .core = ARDUINO_RUNNING_CORE == 0 ? 1 : 0,
+        .priority = 1,
+        .stackSize = 8'192,
+    };
+    static GuiTask singleton(createGuiEngine, configuration);
+    return singleton;
+}
 } // namespace board
@@ -0,0 +1,93 @@
+#include "keypadInput.hpp"
+#include <lvgl.h>
+
+static IKeypad *myKeypad = nullptr;
+
+/**
+ * @brief implementation for lvgl read_cb for the left key
+ */
+static void keypad_read_left(lv_indev_drv_t *indev_drv, lv_indev_data_t *data)
+{
+    if (!myKeypad)
+        return;
+
+    // assign key state
+    data->state = (myKeypad->isKeyPressed(KeyId::LEFT)) ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+    data->key = LV_KEY_PREV;
+}
+
+/**
+ * @brief implementation for lvgl read_cb for the right key
+ */
+static void keypad_read_right(lv_indev_drv_t *indev_drv, lv_indev_data_t *data)
+{
+    if (!myKeypad)
+        return;
+
+    // assign key state
+    data->state = (myKeypad->isKeyPressed(KeyId::RIGHT)) ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+    data->key = LV_KEY_NEXT;
+}
+
+/**
+ * @brief implementation for lvgl read_cb for the enter key
+ */
+static void keypad_read_enter(lv_indev_drv_t *indev_drv, lv_indev_data_t *data)
+{
+    if (!myKeypad)
+        return;
+
+    // assign key state
+    data->state = (myKeypad->isKeyPressed(KeyId::ENTER)) ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+    data->key = LV_KEY_ENTER;
+}
+
+/**
+ * @brief implementation for lvgl read_cb for the back key
+ */
+static void keypad_read_back(lv_indev_drv_t *indev_drv, lv_indev_data_t *data)
+{
+    if (!myKeypad)
+        return;
+
+    // assign key state
+    data->state = (myKeypad->isKeyPressed(KeyId::BACK)) ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+    data->key = LV_KEY_ESC;
+}
+
+void registerKeypadInput(IKeypad *keypad)
+{
+    //assign keypad reference to local pointer
+    myKeypad = keypad;
+
+    // create default group for button navigation and assign input device to it
+    static lv_group_t *const group = lv_group_create();
+    lv_group_set_default(group);
+
+    // Register all buttons as individual indev, so they all have their separate "old" state (lvgl has only one "old" state per indev)
+    static lv_indev_drv_t indev_drv_left;
+    lv_indev_drv_init(&indev_drv_left);
+    indev_drv_left.type = LV_INDEV_TYPE_KEYPAD;
+    indev_drv_left.read_cb = keypad_read_left;
+
+    static lv_indev_drv_t indev_drv_right;
+    lv_indev_drv_init(&indev_drv_right);
+    indev_drv_right.type = LV_INDEV_TYPE_KEYPAD;
+    indev_drv_right.read_cb = keypad_read_right;
+
+    static lv_indev_drv_t indev_drv_enter;
+    lv_indev_drv_init(&indev_drv_enter);
+    indev_drv_enter.type = LV_INDEV_TYPE_KEYPAD;
+    indev_drv_enter.read_cb = keypad_read_enter;
+
+    static lv_indev_drv_t indev_drv_back;
+    lv_indev_drv_init(&indev_drv_back);
+    indev_drv_back.type = LV_INDEV_TYPE_KEYPAD;
+    indev_drv_back.read_cb = keypad_read_back;
+
+    // Register the drivers in LVGL and save the created input device object
+    lv_indev_set_group(lv_indev_drv_register(&indev_drv_left), group);
+    lv_indev_set_group(lv_indev_drv_register(&indev_drv_right), group);
+    lv_indev_set_group(lv_indev_drv_register(&indev_drv_enter), group);
+    lv_indev_set_group(lv_indev_drv_register(&indev_drv_back), group);
+}
@@ -0,0 +1,17 @@
+/**
+ * \file .
+ * Connects the keypad to LVGL.
+ */
+#pragma once
+
+#include <user_interaction/IKeypad.hpp>
+
+/**
+ * Registers each navigation key as an input device of LVGL.
+ *
+ * The input devices are assigned to a default group, which is replaced by the group of each screen.
+ * Must be called once, after LVGL has been initialized.
+ *
+ * \param keypad to read the keys from; must outlive LVGL
+ */
+void registerKeypadInput(IKeypad *keypad);
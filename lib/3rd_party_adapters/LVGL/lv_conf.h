@@ -84,8 +84,13 @@
 #define LV_INDEV_DEF_READ_PERIOD 30     /*[ms]*/
 
 /*Use a custom tick source that tells the elapsed time in milliseconds.
- *It removes the need to manually update the tick with `lv_tick_inc()`)*/
+ *It removes the need to manually update the tick with `lv_tick_inc()`)
+ *Without Arduino-ESP32, that is in native unit tests, HeadlessGuiEngine updates the tick.*/
+#if __has_include(<esp32-hal.h>)
 #define LV_TICK_CUSTOM 1
+#else
+#define LV_TICK_CUSTOM 0
+#endif
 #if LV_TICK_CUSTOM
     #define LV_TICK_CUSTOM_INCLUDE "Arduino.h"         /*Header for the system time function*/
     #define LV_TICK_CUSTOM_SYS_TIME_EXPR (millis())    /*Expression evaluating to current system time in ms*/
@@ -0,0 +1,23 @@
+#include "pageLayoutRendering.hpp"
+
+page_layout::Area toPageLayoutArea(const lv_area_t &area)
+{
+    return {.x1 = area.x1, .y1 = area.y1, .x2 = area.x2, .y2 = area.y2};
+}
+
+void roundToPages(lv_disp_drv_t *disp_drv, lv_area_t *area)
+{
+    auto pageArea = toPageLayoutArea(*area);
+    page_layout::roundToPages(pageArea);
+    area->y1 = pageArea.y1;
+    area->y2 = pageArea.y2;
+}
+
+void setPixelInPages(lv_disp_drv_t *disp_drv, uint8_t *buf, lv_coord_t buf_w, lv_coord_t x, lv_coord_t y, lv_color_t color, lv_opa_t opa)
+{
+    if (opa < LV_OPA_50)
+    {
+        return; // mostly transparent: keep the background
+    }
+    page_layout::setPixel(buf, buf_w, x, y, color.full);
+}
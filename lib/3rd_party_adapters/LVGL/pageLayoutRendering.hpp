@@ -0,0 +1,26 @@
+/**
+ * \file .
+ * Lets LVGL render directly into the page layout of monochrome displays like the SSD1306.
+ */
+#pragma once
+
+#include <display_interface/page_layout.hpp>
+#include <lvgl.h>
+
+static_assert(LV_COLOR_DEPTH == 1, "LVGL renders directly into the page layout of the monochrome display");
+
+page_layout::Area toPageLayoutArea(const lv_area_t &area);
+
+/**
+ * Extends the areas to be redrawn to whole pages of the display.
+ *
+ * Is the rounder_cb of the display driver.
+ */
+void roundToPages(lv_disp_drv_t *disp_drv, lv_area_t *area);
+
+/**
+ * Renders a pixel into the draw buffer using the page layout of the display.
+ *
+ * Is the set_px_cb of the display driver.
+ */
+void setPixelInPages(lv_disp_drv_t *disp_drv, uint8_t *buf, lv_coord_t buf_w, lv_coord_t x, lv_coord_t y, lv_color_t color, lv_opa_t opa);
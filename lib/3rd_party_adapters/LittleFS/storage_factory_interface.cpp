@@ -0,0 +1,20 @@
+#include <LittleFS.h>
+#include <persistent_storage/FileStorage.hpp>
+#include <serial_interface/serial_port.hpp>
+#include <storage/storage_factory_interface.hpp>
+
+namespace board
+{
+IStorage &getStorage()
+{
+    static constexpr auto basePath = "/littlefs";
+    static const bool isMounted = LittleFS.begin(true, basePath); // format the partition if it cannot be mounted
+    static FileStorage storage(basePath);
+    if (!isMounted)
+    {
+        // the tasks work anyway, but they are lost at the next restart
+        serial_port::cout << "ERROR: File system could not be mounted; the tasks are not persisted." << std::endl;
+    }
+    return storage;
+}
+} // namespace board
@@ -1,6 +1,7 @@
 #include <nlohmann/json.hpp>
 #include <serial_interface/JsonGenerator.hpp>
 #include <serial_protocol/DeletedTaskObject.hpp>
+#include <serial_protocol/KeyBindingObject.hpp>
 #include <serial_protocol/ProtocolVersionObject.hpp>
 #include <serial_protocol/TaskList.hpp>
 #include <serial_protocol/TaskObject.hpp>
@@ -39,24 +40,30 @@ std::string toJsonString<task_tracker_systems::TaskObject>(const task_tracker_sy
     return jsonObject.dump(defaultJsonIndent);
 }
 
-void to_json(nlohmann::json &jsonObject, const device::TaskCollection::value_type &object)
+template <>
+std::string toJsonString<device::TaskCollection>(const device::TaskCollection &container)
 {
-    jsonObject["id"] = object.first;
-    jsonObject["label"] = object.second.getLabel();
-    jsonObject["duration"] = object.second.getLastRecordedDuration().count();
+    auto jsonObject = nlohmann::json::array();
+    device::sampleRecordedDurations(container, [&jsonObject](const TaskId id, const Task &task, const Task::Duration duration) {
+        const task_tracker_systems::TaskObject object = {.id = id, .label = task.getLabel(), .duration = duration.count()};
+        jsonObject.emplace_back(object);
+    });
+    return jsonObject.dump(defaultJsonIndent);
 }
 
 template <>
-std::string toJsonString<device::TaskCollection>(const device::TaskCollection &container)
+std::string toJsonString<task_tracker_systems::DeletedTaskObject>(const task_tracker_systems::DeletedTaskObject &object)
 {
-    nlohmann::json jsonObject(container);
+    auto jsonObject = nlohmann::json::object();
+    jsonObject["id"] = object.id;
     return jsonObject.dump(defaultJsonIndent);
 }
 
 template <>
-std::string toJsonString<task_tracker_systems::DeletedTaskObject>(const task_tracker_systems::DeletedTaskObject &object)
+std::string toJsonString<task_tracker_systems::KeyBindingObject>(const task_tracker_systems::KeyBindingObject &object)
 {
     auto jsonObject = nlohmann::json::object();
+    jsonObject["key"] = object.key;
     jsonObject["id"] = object.id;
     return jsonObject.dump(defaultJsonIndent);
 }
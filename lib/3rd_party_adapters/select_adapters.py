@@ -0,0 +1,11 @@
+"""
+Selects the adapters which are built, as not every environment provides all 3rd party libraries.
+
+An environment in platformio.ini may set the option `custom_adapters_filter` in the syntax of `build_src_filter`.
+Without it, all adapters are built.
+"""
+Import("env")
+
+adapters_filter = env.GetProjectOption("custom_adapters_filter", "")
+if adapters_filter:
+    env.Replace(SRC_FILTER=adapters_filter)
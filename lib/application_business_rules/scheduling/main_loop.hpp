@@ -0,0 +1,36 @@
+/**
+ * \file .
+ * Lets the main loop sleep until there is work to do.
+ */
+#pragma once
+
+#include <chrono>
+
+namespace main_loop
+{
+/**
+ * Prepares the notification of the main loop.
+ *
+ * Must be called from the context of the main loop before any notification.
+ */
+void initialize();
+
+/**
+ * Wakes up the main loop.
+ *
+ * Notifications are not counted; several notifications before the main loop wakes up, wake it up once.
+ * May be called from any context, including interrupts.
+ */
+void notify();
+
+/**
+ * Blocks the main loop until it is notified or the timeout expires.
+ *
+ * Returns immediately if it has been notified since the last call.
+ * Must only be called from the context of the main loop.
+ * \param timeout maximum time to wait
+ * \retval true if it has been notified
+ * \retval false if the timeout has expired
+ */
+bool waitForWork(std::chrono::milliseconds timeout);
+} // namespace main_loop
@@ -10,17 +10,21 @@ namespace cli = command_line_interpreter;
 // --------------------------
 #include "JsonGenerator.hpp"
 #include <serial_protocol/DeletedTaskObject.hpp>
+#include <serial_protocol/KeyBindingObject.hpp>
 #include <serial_protocol/ProtocolVersionObject.hpp>
 #include <serial_protocol/TaskList.hpp>
 #include <serial_protocol/TaskObject.hpp>
+#include <storage/TaskJournal.hpp>
 #include <string>
 #include <tasks/Task.hpp>
+#include <user_interaction/TaskKeyBindings.hpp>
+#include <user_interaction/board_interface.hpp>
 
 using namespace task_tracker_systems;
 
 // command for info
 static const auto info = []() {
-    constexpr ProtocolVersionObject version = {.major = 0, .minor = 1, .patch = 0};
+    constexpr ProtocolVersionObject version = {.major = 0, .minor = 3, .patch = 0};
     serial_port::cout << toJsonString(version) << std::endl;
 };
 static const auto infoCmd = cli::makeCommand("info", std::function(info));
@@ -36,6 +40,7 @@ static const auto edit = [](const TaskId id, const std::basic_string<ProtocolHan
         auto &task = device::tasks.at(id);
         task.setLabel(label);
         task.setRecordedDuration(std::chrono::seconds(duration));
+        device::journal.recordEdit(id, task);
         const TaskObject taskObject = {.id = id, .label = task.getLabel(), .duration = task.getLastRecordedDuration().count()};
         serial_port::cout << toJsonString(taskObject) << std::endl;
     }
@@ -55,6 +60,10 @@ static const auto add = [](const TaskId id, const std::basic_string<ProtocolHand
     {
         const auto &[element, created] = device::tasks.try_emplace(id, label, std::chrono::seconds(duration));
         const auto &task = element->second;
+        if (created)
+        {
+            device::journal.recordAdd(id, task);
+        }
         const TaskObject taskObject = {.id = element->first, .label = task.getLabel(), .duration = task.getLastRecordedDuration().count()};
         serial_port::cout << toJsonString(taskObject) << std::endl;
         if (!created)
@@ -72,6 +81,10 @@ static const auto addCmd = cli::makeCommand("add", std::function(add), std::make
 // command for delete/remove
 static const auto del = [](const TaskId id) {
     const bool deleted = device::tasks.erase(id) > 0;
+    if (deleted)
+    {
+        device::journal.recordDelete(id);
+    }
     const DeletedTaskObject taskObject{.id = id};
     serial_port::cout << toJsonString(taskObject) << std::endl;
     if (!deleted)
@@ -81,7 +94,32 @@ static const auto del = [](const TaskId id) {
 };
 static const auto delCmd = cli::makeCommand("delete", std::function(del), std::make_tuple(&id));
 
-static const std::array<const cli::BaseCommand<char> *, 5> commands = {&listCmd, &editCmd, &infoCmd, &addCmd, &delCmd};
+// command for binding a task key to a task
+static const auto bind = [](const unsigned int key, const TaskId id) {
+    const bool isValidKey = key >= 1 && key <= TaskKeyBindings::numberOfKeys;
+    if (!isValidKey)
+    {
+        serial_port::cout << "ERROR: Invalid key. Valid keys are 1 to " << TaskKeyBindings::numberOfKeys << "." << std::endl;
+        return;
+    }
+    const auto keyId = static_cast<KeyId>(static_cast<unsigned int>(KeyId::TASK1) + key - 1);
+    device::taskKeyBindings.bind(keyId, id);
+    device::journal.recordBind(key - 1, id);
+    const KeyBindingObject bindingObject{.key = key, .id = id};
+    serial_port::cout << toJsonString(bindingObject) << std::endl;
+    if (device::tasks.find(id) == device::tasks.end())
+    {
+        serial_port::cout << "WARNING: Task does not exist (yet)." << std::endl;
+    }
+};
+static const cli::Option<unsigned int> key = {.labels = {"--key"}, .defaultValue = 0};
+static const auto bindCmd = cli::makeCommand("bind", std::function(bind), std::make_tuple(&key, &id));
+
+// command for diagnostics of the board
+static const auto stats = []() { board::printDiagnostics(serial_port::cout); };
+static const auto statsCmd = cli::makeCommand("stats", std::function(stats));
+
+static const std::array<const cli::BaseCommand<char> *, 7> commands = {&listCmd, &editCmd, &infoCmd, &addCmd, &delCmd, &bindCmd, &statsCmd};
 
 bool ProtocolHandler::execute(const CharType *const commandLine)
 {
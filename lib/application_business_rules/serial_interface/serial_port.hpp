@@ -60,6 +60,14 @@ void setCallbackForLineReception(const StringHandler &callback);
 
 void readAndHandleInput();
 
+/**
+ * Set a function to be called when data has been received via serial_port.
+ *
+ * Allows to handle input as soon as it has been received instead of polling for it.
+ * \param callback is called from the context of the serial driver; must not block
+ */
+void setCallbackForDataReception(const std::function<void(void)> &callback);
+
 } // namespace serial_port
 
 /**
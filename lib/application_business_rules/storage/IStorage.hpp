@@ -0,0 +1,53 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Interface to a persistent storage for a log-structured store.
+ *
+ * The storage consists of a snapshot and a journal.
+ * Both are opaque sequences of bytes.
+ * The journal can only be appended to, the snapshot can only be replaced as a whole.
+ *
+ * This is the \ref application_business_rules "data gateway" for the persistent data.
+ * It is used to implement the \ref plugin_architecture.
+ */
+class IStorage
+{
+  public:
+    typedef std::vector<std::uint8_t> Bytes;
+
+    /**
+     * \returns the content of the snapshot; empty if there is none
+     */
+    virtual Bytes readSnapshot() = 0;
+
+    /**
+     * Replaces the snapshot and clears the journal afterwards.
+     *
+     * Replacing the snapshot must be atomic:
+     * In case of a power loss, either the old or the new snapshot must be readable afterwards.
+     * If the journal cannot be cleared, the records appended afterwards follow the records of the old snapshot.
+     * \param data the new content of the snapshot
+     * \param size number of bytes
+     * \returns whether the snapshot has been replaced; if not, the old snapshot and the journal are unchanged
+     */
+    virtual bool writeSnapshot(const std::uint8_t *data, std::size_t size) = 0;
+
+    /**
+     * \returns the content of the journal; empty if there is none
+     */
+    virtual Bytes readJournal() = 0;
+
+    /**
+     * Appends data to the journal.
+     *
+     * In case of a power loss, a part of the data may be missing at the end of the journal.
+     * \param data to be appended
+     * \param size number of bytes
+     */
+    virtual void appendJournal(const std::uint8_t *data, std::size_t size) = 0;
+
+    virtual ~IStorage(){};
+};
@@ -0,0 +1,646 @@
+#include "TaskJournal.hpp"
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+#include <varint.hpp>
+#include <vector>
+
+/**
+ * Identifies the format of a snapshot.
+ *
+ * The last byte is the version of the format.
+ */
+static constexpr std::array<std::uint8_t, 4> snapshotMagic = {'T', 'T', 'S', 3};
+
+static constexpr std::uint8_t runningFlag = 0x01;
+
+/**
+ * Flag of the whole snapshot: the default tasks have been provided.
+ */
+static constexpr std::uint8_t initializedFlag = 0x01;
+
+static constexpr std::size_t checksumSize = 2;
+
+static constexpr std::array<std::uint16_t, 256> createChecksumTable()
+{
+    std::array<std::uint16_t, 256> table{};
+    for (std::size_t index = 0; index < table.size(); ++index)
+    {
+        std::uint16_t crc = static_cast<std::uint16_t>(index << 8);
+        for (int bit = 0; bit < 8; ++bit)
+        {
+            crc = (crc & 0x8000) ? static_cast<std::uint16_t>((crc << 1) ^ 0x1021) : static_cast<std::uint16_t>(crc << 1);
+        }
+        table[index] = crc;
+    }
+    return table;
+}
+
+/**
+ * Lookup table for processing a byte at once; placed in flash.
+ */
+static constexpr std::array<std::uint16_t, 256> checksumTable = createChecksumTable();
+
+/**
+ * CRC-16/CCITT-FALSE
+ */
+static std::uint16_t calculateChecksum(const std::uint8_t *data, const std::size_t size)
+{
+    std::uint16_t crc = 0xFFFF;
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        crc = static_cast<std::uint16_t>((crc << 8) ^ checksumTable[(crc >> 8) ^ data[index]]);
+    }
+    return crc;
+}
+
+static std::uint8_t *encodeChecksum(const std::uint8_t *begin, std::uint8_t *const end)
+{
+    const std::uint16_t checksum = calculateChecksum(begin, end - begin);
+    end[0] = static_cast<std::uint8_t>(checksum);
+    end[1] = static_cast<std::uint8_t>(checksum >> 8);
+    return end + checksumSize;
+}
+
+static bool isChecksumValid(const std::uint8_t *begin, const std::uint8_t *const end)
+{
+    const std::uint16_t checksum = calculateChecksum(begin, end - begin);
+    return end[0] == static_cast<std::uint8_t>(checksum) && end[1] == static_cast<std::uint8_t>(checksum >> 8);
+}
+
+static std::uint64_t toSeconds(const Task::Duration duration)
+{
+    return static_cast<std::uint64_t>(std::max(duration, Task::Duration::zero()).count());
+}
+
+/**
+ * Reads the fields of a record or of a snapshot.
+ *
+ * Any read beyond the end marks the reader as invalid.
+ */
+class Reader
+{
+  public:
+    Reader(const std::uint8_t *begin, const std::uint8_t *end) : position(begin), end(end)
+    {
+    }
+
+    template <class Unsigned>
+    Unsigned read()
+    {
+        Unsigned value = 0;
+        position = position ? decodeVarint(position, end, value) : nullptr;
+        return value;
+    }
+
+    std::uint8_t readByte()
+    {
+        if (!position || position == end)
+        {
+            position = nullptr;
+            return 0;
+        }
+        return *position++;
+    }
+
+    /**
+     * \returns a view into the read data; valid as long as the read data
+     */
+    std::string_view readString()
+    {
+        const auto size = read<std::size_t>();
+        if (!position || static_cast<std::size_t>(end - position) < size)
+        {
+            position = nullptr;
+            return std::string_view();
+        }
+        const std::string_view value(reinterpret_cast<const char *>(position), size);
+        position += size;
+        return value;
+    }
+
+    bool isValid() const
+    {
+        return position != nullptr;
+    }
+
+    bool isAtEnd() const
+    {
+        return position == end;
+    }
+
+  private:
+    const std::uint8_t *position;
+    const std::uint8_t *const end;
+};
+
+/**
+ * Locates the payload of the record at the beginning of a journal.
+ *
+ * \param[in,out] position beginning of the record; set to the beginning of the next record
+ * \returns reader of the payload; invalid if the record is incomplete
+ */
+static Reader readRecord(const std::uint8_t *&position, const std::uint8_t *const end)
+{
+    std::size_t size;
+    const std::uint8_t *const payload = decodeVarint(position, end, size);
+    if (!payload || static_cast<std::size_t>(end - payload) < size + checksumSize ||
+        !isChecksumValid(payload, payload + size))
+    {
+        return Reader(nullptr, end);
+    }
+    position = payload + size + checksumSize;
+    return Reader(payload, payload + size);
+}
+
+/**
+ * Largest record of a generation: length, type, generation and checksum.
+ */
+static constexpr std::size_t maximumGenerationRecordSize = 1 + 1 + 5 + checksumSize;
+
+/**
+ * Encodes the record which starts a journal.
+ *
+ * \returns end of the record
+ */
+static std::uint8_t *encodeGenerationRecord(const std::uint32_t generation, std::uint8_t *const begin)
+{
+    const std::size_t size = 1 + getVarintSize(generation);
+    std::uint8_t *const payload = encodeVarint(size, begin);
+    std::uint8_t *position = payload;
+    *position++ = static_cast<std::uint8_t>(TaskJournal::RecordType::GENERATION);
+    position = encodeVarint(generation, position);
+    return encodeChecksum(payload, position);
+}
+
+TaskJournal::TaskJournal(const Configuration &configuration) : configuration(configuration)
+{
+}
+
+void TaskJournal::attach(IStorage &newStorage)
+{
+    storage = &newStorage;
+}
+
+/**
+ * Running state of the tasks while restoring.
+ *
+ * Tasks are started after restoring, so that replaying does not add intervals to the history.
+ */
+typedef FlatMap<TaskId, bool> RunningStates;
+
+/**
+ * Loads the tasks from a snapshot in a single pass.
+ *
+ * The tasks are stored in the snapshot ordered by their IDs.
+ * Thus each task is appended to the end of the collection, which is allocated at once.
+ * The assignment of the task keys follows the tasks.
+ *
+ * \param[out] isInitialized whether the default tasks have been provided
+ * \returns the generation of the snapshot; 0 if there is no valid snapshot
+ */
+static std::uint32_t loadSnapshot(const IStorage::Bytes &snapshot, device::TaskCollection &tasks, RunningStates &runningStates,
+                                  TaskJournal::Bindings &bindings, bool &isInitialized)
+{
+    const bool isSnapshotValid = snapshot.size() >= snapshotMagic.size() + checksumSize &&
+                                 std::equal(snapshotMagic.begin(), snapshotMagic.end(), snapshot.begin()) &&
+                                 isChecksumValid(snapshot.data(), snapshot.data() + snapshot.size() - checksumSize);
+    if (!isSnapshotValid)
+    {
+        return 0;
+    }
+    Reader reader(snapshot.data() + snapshotMagic.size(), snapshot.data() + snapshot.size() - checksumSize);
+    const auto generation = reader.read<std::uint32_t>();
+    isInitialized = reader.readByte() & initializedFlag;
+    const auto numberOfTasks = reader.read<std::size_t>();
+    const std::size_t minimumSizeOfTask = 4;
+    tasks.reserve(std::min(numberOfTasks, snapshot.size() / minimumSizeOfTask));
+    for (std::size_t count = 0; count < numberOfTasks && reader.isValid(); ++count)
+    {
+        const auto id = reader.read<TaskId>();
+        const auto duration = Task::Duration(reader.read<std::uint64_t>());
+        const auto flags = reader.readByte();
+        const auto label = reader.readString();
+        if (!reader.isValid())
+        {
+            break;
+        }
+        tasks.try_emplace(id, Task::String(label), duration);
+        if (flags & runningFlag)
+        {
+            runningStates.try_emplace(id, true);
+        }
+    }
+    const auto numberOfBindings = reader.read<std::size_t>();
+    for (std::size_t count = 0; count < numberOfBindings && reader.isValid(); ++count)
+    {
+        const auto key = reader.read<std::size_t>();
+        const auto id = reader.read<TaskId>();
+        if (reader.isValid() && key < bindings.size())
+        {
+            bindings[key] = id;
+        }
+    }
+    return generation;
+}
+
+/**
+ * Locates the records of a journal which continue the snapshot.
+ *
+ * They follow the record of the generation of the snapshot.
+ * If the journal could not be cleared when the snapshot was written, it is preceded by the records of the old snapshot.
+ *
+ * \param[out] isStale whether records of another snapshot precede
+ * \returns the beginning of the records following the generation; `nullptr` if the journal belongs to another snapshot
+ */
+static const std::uint8_t *skipGeneration(const IStorage::Bytes &journal, const std::uint32_t generation, bool &isStale)
+{
+    const std::uint8_t *position = journal.data();
+    const std::uint8_t *const end = journal.data() + journal.size();
+    isStale = false;
+    while (position != end)
+    {
+        Reader reader = readRecord(position, end);
+        const auto type = static_cast<TaskJournal::RecordType>(reader.readByte());
+        if (!reader.isValid())
+        {
+            return nullptr;
+        }
+        if (type == TaskJournal::RecordType::GENERATION && reader.read<std::uint32_t>() == generation && reader.isValid())
+        {
+            return position;
+        }
+        isStale = true;
+    }
+    return nullptr;
+}
+
+/**
+ * Applies the records of a journal.
+ *
+ * \returns end of the complete records
+ */
+static const std::uint8_t *replayJournal(const std::uint8_t *position, const std::uint8_t *const end, device::TaskCollection &tasks,
+                                         RunningStates &runningStates, TaskJournal::Bindings &bindings, bool &isInitialized)
+{
+    while (position != end)
+    {
+        Reader reader = readRecord(position, end);
+        if (!reader.isValid())
+        {
+            break; // incomplete record at the end of the journal
+        }
+        const auto type = static_cast<TaskJournal::RecordType>(reader.readByte());
+        if (type == TaskJournal::RecordType::GENERATION)
+        {
+            // written again if a snapshot could not be written; the following records are still based on this snapshot
+            continue;
+        }
+        if (type == TaskJournal::RecordType::BIND)
+        {
+            const auto key = reader.read<std::size_t>();
+            const auto id = reader.read<TaskId>();
+            if (reader.isValid() && key < bindings.size())
+            {
+                bindings[key] = id;
+            }
+            continue;
+        }
+        if (type == TaskJournal::RecordType::INITIALIZE)
+        {
+            isInitialized = true;
+            continue;
+        }
+        const auto id = reader.read<TaskId>();
+        const auto task = tasks.find(id);
+        switch (type)
+        {
+        case TaskJournal::RecordType::ADD: {
+            const auto duration = Task::Duration(reader.read<std::uint64_t>());
+            const auto label = reader.readString();
+            if (reader.isValid() && task == tasks.end())
+            {
+                tasks.try_emplace(id, Task::String(label), duration);
+            }
+            break;
+        }
+        case TaskJournal::RecordType::EDIT: {
+            const auto duration = Task::Duration(reader.read<std::uint64_t>());
+            const auto label = reader.readString();
+            if (reader.isValid() && task != tasks.end())
+            {
+                task->second.setLabel(Task::String(label));
+                task->second.setRecordedDuration(duration);
+            }
+            break;
+        }
+        case TaskJournal::RecordType::DELETE:
+            tasks.erase(id);
+            runningStates.erase(id);
+            break;
+        case TaskJournal::RecordType::START:
+            runningStates.try_emplace(id, false).first->second = true;
+            break;
+        case TaskJournal::RecordType::STOP: {
+            const auto duration = Task::Duration(reader.read<std::uint64_t>());
+            if (reader.isValid() && task != tasks.end())
+            {
+                task->second.setRecordedDuration(duration);
+            }
+            const auto state = runningStates.find(id);
+            if (state != runningStates.end())
+            {
+                state->second = false;
+            }
+            break;
+        }
+        default:
+            break; // unknown records are skipped
+        }
+    }
+    return position;
+}
+
+void TaskJournal::restore(device::TaskCollection &tasks)
+{
+    tasks.clear();
+    bindings.fill(std::nullopt);
+    initialized = false;
+    if (!storage)
+    {
+        return;
+    }
+    RunningStates runningStates;
+    generation = loadSnapshot(storage->readSnapshot(), tasks, runningStates, bindings, initialized);
+    const IStorage::Bytes journal = storage->readJournal();
+    journalSize = journal.size();
+    if (!journal.empty())
+    {
+        bool isStale;
+        const std::uint8_t *const records = skipGeneration(journal, generation, isStale);
+        const std::uint8_t *const end = journal.data() + journal.size();
+        if (!records || isStale)
+        {
+            // the journal of a previous snapshot has not been cleared; records appended to it would be skipped as well
+            snapshotRequired = true;
+        }
+        if (records && replayJournal(records, end, tasks, runningStates, bindings, initialized) != end)
+        {
+            // records appended after an incomplete record would never be replayed
+            snapshotRequired = true;
+        }
+    }
+
+    for (const auto &[id, isRunning] : runningStates)
+    {
+        const auto task = tasks.find(id);
+        if (isRunning && task != tasks.end())
+        {
+            task->second.start();
+        }
+    }
+    lastSnapshot = Clock::now();
+}
+
+void TaskJournal::recordAdd(const TaskId id, const Task &task)
+{
+    record(RecordType::ADD, id, &task);
+}
+
+void TaskJournal::recordEdit(const TaskId id, const Task &task)
+{
+    record(RecordType::EDIT, id, &task);
+}
+
+void TaskJournal::recordDelete(const TaskId id)
+{
+    record(RecordType::DELETE, id, nullptr);
+}
+
+void TaskJournal::recordStart(const TaskId id)
+{
+    record(RecordType::START, id, nullptr);
+}
+
+void TaskJournal::recordStop(const TaskId id, const Task &task)
+{
+    record(RecordType::STOP, id, &task);
+}
+
+void TaskJournal::recordBind(const std::size_t key, const TaskId id)
+{
+    if (key >= bindings.size())
+    {
+        return;
+    }
+    bindings[key] = id;
+    std::uint8_t *const payload = reserveRecord(1 + getVarintSize(key) + getVarintSize(id));
+    if (!payload)
+    {
+        return;
+    }
+    std::uint8_t *position = payload;
+    *position++ = static_cast<std::uint8_t>(RecordType::BIND);
+    position = encodeVarint(key, position);
+    position = encodeVarint(id, position);
+    pendingSize = encodeChecksum(payload, position) - pending.data();
+}
+
+const TaskJournal::Bindings &TaskJournal::getBindings() const
+{
+    return bindings;
+}
+
+void TaskJournal::recordInitialization()
+{
+    initialized = true;
+    std::uint8_t *const payload = reserveRecord(1);
+    if (!payload)
+    {
+        return;
+    }
+    std::uint8_t *position = payload;
+    *position++ = static_cast<std::uint8_t>(RecordType::INITIALIZE);
+    pendingSize = encodeChecksum(payload, position) - pending.data();
+}
+
+bool TaskJournal::isInitialized() const
+{
+    return initialized;
+}
+
+/**
+ * Reserves space for a record in the buffer of pending records.
+ *
+ * \param payloadSize number of bytes of the record without its framing
+ * \returns where to encode the payload; `nullptr` if nothing shall be recorded
+ */
+std::uint8_t *TaskJournal::reserveRecord(const std::size_t payloadSize)
+{
+    if (!storage)
+    {
+        return nullptr;
+    }
+    const std::size_t recordSize = getVarintSize(payloadSize) + payloadSize + checksumSize;
+    if (pendingSize + recordSize > pending.size())
+    {
+        // the snapshot will contain the modification anyway
+        snapshotRequired = true;
+        return nullptr;
+    }
+    if (pendingSize == 0)
+    {
+        oldestPending = Clock::now();
+    }
+    return encodeVarint(payloadSize, &pending[pendingSize]);
+}
+
+void TaskJournal::record(const RecordType type, const TaskId id, const Task *const task)
+{
+    const bool hasDuration = task != nullptr;
+    const bool hasLabel = type == RecordType::ADD || type == RecordType::EDIT;
+    const std::uint64_t duration = hasDuration ? toSeconds(task->getLastRecordedDuration()) : 0;
+    const std::size_t labelSize = hasLabel ? task->getLabel().size() : 0;
+
+    std::size_t size = 1 + getVarintSize(id);
+    size += hasDuration ? getVarintSize(duration) : 0;
+    size += hasLabel ? getVarintSize(labelSize) + labelSize : 0;
+
+    std::uint8_t *const payload = reserveRecord(size);
+    if (!payload)
+    {
+        return;
+    }
+    std::uint8_t *position = payload;
+    *position++ = static_cast<std::uint8_t>(type);
+    position = encodeVarint(id, position);
+    if (hasDuration)
+    {
+        position = encodeVarint(duration, position);
+    }
+    if (hasLabel)
+    {
+        position = encodeVarint(labelSize, position);
+        std::memcpy(position, task->getLabel().data(), labelSize);
+        position += labelSize;
+    }
+    pendingSize = encodeChecksum(payload, position) - pending.data();
+}
+
+void TaskJournal::loop(const device::TaskCollection &tasks)
+{
+    if (!storage)
+    {
+        return;
+    }
+    const auto now = Clock::now();
+    bool isCompactionRequired = snapshotRequired;
+    const bool isFlushRequired = pendingSize >= configuration.flushThreshold ||
+                                 (pendingSize > 0 && now - oldestPending >= configuration.flushDelay);
+    if (now - lastSnapshot >= configuration.snapshotInterval)
+    {
+        isCompactionRequired |= std::any_of(tasks.begin(), tasks.end(), [](const auto &element) {
+            return element.second.isRunning();
+        });
+        // without running tasks there is nothing to preserve; check again after the next interval
+        lastSnapshot = now;
+    }
+
+    if (isCompactionRequired)
+    {
+        compact(tasks);
+    }
+    else if (isFlushRequired)
+    {
+        flush();
+        if (journalSize >= configuration.compactionThreshold)
+        {
+            compact(tasks);
+        }
+    }
+}
+
+void TaskJournal::flush()
+{
+    if (!storage)
+    {
+        return;
+    }
+    if (pendingSize > 0)
+    {
+        if (journalSize == 0)
+        {
+            std::array<std::uint8_t, maximumGenerationRecordSize> record;
+            const std::size_t recordSize = encodeGenerationRecord(generation, record.data()) - record.data();
+            storage->appendJournal(record.data(), recordSize);
+            journalSize += recordSize;
+        }
+        storage->appendJournal(pending.data(), pendingSize);
+        journalSize += pendingSize;
+        pendingSize = 0;
+    }
+}
+
+void TaskJournal::compact(const device::TaskCollection &tasks)
+{
+    if (!storage)
+    {
+        return;
+    }
+    const auto now = Clock::now();
+
+    const std::uint32_t nextGeneration = generation + 1;
+    std::size_t size = snapshotMagic.size() + getVarintSize(nextGeneration) + 1 + getVarintSize(tasks.size()) + checksumSize;
+    for (const auto &[id, task] : tasks)
+    {
+        const std::size_t labelSize = task.getLabel().size();
+        size += getVarintSize(id) + getVarintSize(toSeconds(task.getRecordedDuration(now))) + 1 +
+                getVarintSize(labelSize) + labelSize;
+    }
+    const auto numberOfBindings = static_cast<std::size_t>(
+        std::count_if(bindings.begin(), bindings.end(), [](const auto &id) { return id.has_value(); }));
+    size += getVarintSize(numberOfBindings);
+    for (std::size_t key = 0; key < bindings.size(); ++key)
+    {
+        size += bindings[key] ? getVarintSize(key) + getVarintSize(*bindings[key]) : 0;
+    }
+    std::vector<std::uint8_t> snapshot(size);
+    std::uint8_t *position = std::copy(snapshotMagic.begin(), snapshotMagic.end(), snapshot.data());
+    position = encodeVarint(nextGeneration, position);
+    *position++ = initialized ? initializedFlag : 0;
+    position = encodeVarint(tasks.size(), position);
+    for (const auto &[id, task] : tasks)
+    {
+        const auto &label = task.getLabel();
+        position = encodeVarint(id, position);
+        position = encodeVarint(toSeconds(task.getRecordedDuration(now)), position);
+        *position++ = task.isRunning() ? runningFlag : 0;
+        position = encodeVarint(label.size(), position);
+        position = std::copy(label.begin(), label.end(), position);
+    }
+    position = encodeVarint(numberOfBindings, position);
+    for (std::size_t key = 0; key < bindings.size(); ++key)
+    {
+        if (bindings[key])
+        {
+            position = encodeVarint(key, position);
+            position = encodeVarint(*bindings[key], position);
+        }
+    }
+    encodeChecksum(snapshot.data(), position);
+
+    if (!storage->writeSnapshot(snapshot.data(), snapshot.size()))
+    {
+        // the journal still continues the old snapshot
+        flush();
+        return;
+    }
+    // pending records are covered by the snapshot
+    pendingSize = 0;
+    snapshotRequired = false;
+    generation = nextGeneration;
+    journalSize = 0;
+    lastSnapshot = now;
+}
+
+TaskJournal device::journal;
@@ -0,0 +1,210 @@
+/**
+ * \file .
+ */
+#pragma once
+#include "IStorage.hpp"
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <tasks/Task.hpp>
+
+/**
+ * Log-structured persistence of the tasks.
+ *
+ * Each modification of a task is appended as a record to the journal of the \ref IStorage "storage".
+ * From time to time the journal is compacted:
+ * A snapshot of all tasks replaces the previous snapshot and the journal is cleared.
+ * At startup the tasks are restored from the snapshot and the journal is replayed on top of it.
+ *
+ * Recording a modification neither accesses the storage nor allocates memory.
+ * The records are collected in a buffer in RAM and written in batches by \ref loop().
+ * Thus recording is cheap and the number of write accesses to the flash is limited.
+ * Like the tasks themselves, the journal must only be used from the context which owns the tasks.
+ * If the buffer is full, the record is dropped and a snapshot is scheduled instead.
+ *
+ * The assignment of the task keys to tasks is persisted the same way.
+ * So is whether the default tasks have been provided, so that they are not provided again after all tasks have been deleted.
+ *
+ * Each record is framed by its length and a checksum.
+ * A record which has only partially been written due to a power loss ends the replay.
+ *
+ * Each snapshot has a generation, which is incremented with every compaction.
+ * A journal starts with a record of the generation of the snapshot it continues.
+ * Replacing the snapshot and clearing the journal are two steps; after a power loss in between,
+ * the journal still belongs to the previous snapshot. Then it is skipped,
+ * as the snapshot already contains all its modifications, which must not be applied again.
+ * If the journal could not be cleared at all, the records of the new generation follow those of the previous one.
+ */
+class TaskJournal
+{
+  public:
+    typedef Task::Clock Clock;
+
+    /**
+     * Kind of modification stored in a record of the journal.
+     */
+    enum class RecordType : std::uint8_t
+    {
+        ADD = 1,
+        EDIT,
+        DELETE,
+        START,
+        STOP,
+        GENERATION, ///< first record of a journal; the generation of the snapshot the journal belongs to
+        BIND,       ///< assignment of a task key to a task
+        INITIALIZE, ///< the default tasks have been provided at the very first start
+    };
+
+    /**
+     * Number of task keys whose assignment is persisted.
+     */
+    static constexpr std::size_t numberOfBindings = 4;
+
+    /**
+     * IDs of the tasks assigned to the task keys; the index is the number of the key, beginning at 0.
+     */
+    typedef std::array<std::optional<TaskId>, numberOfBindings> Bindings;
+
+    struct Configuration
+    {
+        /**
+         * Pending records are written as soon as they exceed this number of bytes.
+         */
+        std::size_t flushThreshold;
+
+        /**
+         * Pending records are written at the latest after this time.
+         */
+        std::chrono::milliseconds flushDelay;
+
+        /**
+         * The journal is compacted as soon as it exceeds this number of bytes.
+         */
+        std::size_t compactionThreshold;
+
+        /**
+         * While a task is running, a snapshot is written at least this often to preserve the running time.
+         */
+        std::chrono::milliseconds snapshotInterval;
+    };
+
+    static constexpr Configuration defaultConfiguration = {
+        .flushThreshold = 128,
+        .flushDelay = std::chrono::seconds(5),
+        .compactionThreshold = 4096,
+        .snapshotInterval = std::chrono::minutes(5),
+    };
+
+    /**
+     * Size of the buffer for pending records.
+     */
+    static constexpr std::size_t bufferSize = 512;
+
+    TaskJournal(const Configuration &configuration = defaultConfiguration);
+
+    /**
+     * Connects the journal to a storage.
+     *
+     * As long as no storage is attached, recording has no effect.
+     * \param storage used to persist the tasks
+     */
+    void attach(IStorage &storage);
+
+    /**
+     * Restores the tasks from the attached storage.
+     *
+     * Loads the snapshot in a single pass and replays the journal on top of it.
+     * Tasks which have been running are started again.
+     * The restored assignment of the task keys is provided by \ref getBindings().
+     * If the journal ends with an incomplete record, a snapshot is scheduled, which clears the journal.
+     * \param[out] tasks replaced by the restored tasks
+     */
+    void restore(device::TaskCollection &tasks);
+
+    void recordAdd(TaskId id, const Task &task);
+    void recordEdit(TaskId id, const Task &task);
+    void recordDelete(TaskId id);
+    void recordStart(TaskId id);
+    void recordStop(TaskId id, const Task &task);
+
+    /**
+     * Records the assignment of a task key to a task.
+     *
+     * \param key number of the task key, beginning at 0; keys beyond \ref numberOfBindings are ignored
+     * \param id of the task assigned to the key
+     */
+    void recordBind(std::size_t key, TaskId id);
+
+    /**
+     * \returns the assignment of the task keys which has been restored and recorded since
+     */
+    const Bindings &getBindings() const;
+
+    /**
+     * Records that the default tasks have been provided at the very first start.
+     */
+    void recordInitialization();
+
+    /**
+     * \returns whether the default tasks have been provided; restored from the storage
+     */
+    bool isInitialized() const;
+
+    /**
+     * Writes pending records and compacts the journal if necessary.
+     *
+     * Has to be called cyclically, but not from time critical paths.
+     * \param tasks the current state of the tasks; needed for compaction
+     */
+    void loop(const device::TaskCollection &tasks);
+
+    /**
+     * Writes all pending records to the journal.
+     */
+    void flush();
+
+    /**
+     * Replaces the snapshot by the current state and clears the journal.
+     *
+     * If the snapshot cannot be written, the pending records are written to the journal instead.
+     * \param tasks the current state of the tasks
+     */
+    void compact(const device::TaskCollection &tasks);
+
+  private:
+    const Configuration configuration;
+    IStorage *storage = nullptr;
+
+    std::array<std::uint8_t, bufferSize> pending;
+    std::size_t pendingSize = 0;
+    Clock::time_point oldestPending;
+    bool snapshotRequired = false;
+
+    std::size_t journalSize = 0;
+    Clock::time_point lastSnapshot;
+
+    /**
+     * Generation of the latest snapshot.
+     */
+    std::uint32_t generation = 0;
+
+    /**
+     * Assignment of the task keys; needed for the snapshot.
+     */
+    Bindings bindings;
+
+    /**
+     * Whether the default tasks have been provided; needed for the snapshot.
+     */
+    bool initialized = false;
+
+    std::uint8_t *reserveRecord(std::size_t payloadSize);
+    void record(RecordType type, TaskId id, const Task *task);
+};
+
+namespace device
+{
+extern TaskJournal journal;
+}
@@ -0,0 +1,15 @@
+/**
+ * \file .
+ * Dependency injection for the persistent storage.
+ *
+ * \see \ref dependency_injection
+ */
+
+#pragma once
+
+#include "IStorage.hpp"
+
+namespace board
+{
+IStorage &getStorage();
+}
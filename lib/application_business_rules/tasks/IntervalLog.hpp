@@ -0,0 +1,217 @@
+/**
+ * \file .
+ */
+#pragma once
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <varint.hpp>
+
+/**
+ * Append-only history of the intervals in which a task has been running.
+ *
+ * The intervals are stored with a resolution of seconds in a fixed number of blocks of fixed size.
+ * Thus the memory usage is bounded and no dynamic memory is used.
+ * When all blocks are full, the block with the oldest intervals is discarded.
+ *
+ * Within a block each interval is encoded as two variable length integers:
+ * The pause since the end of the previous interval and the length of the interval.
+ * Intervals of minutes or hours need 2 to 3 bytes per value.
+ *
+ * Each block additionally stores the begin of its first interval, the end of its last interval
+ * and the sum of all of its intervals.
+ * Therefore summing up the time within a window only needs to decode blocks which are partially covered by the window.
+ *
+ * The history is kept in RAM only and is lost on restart.
+ * The time points refer to the clock's epoch, which for a monotonic clock is typically the boot of the device.
+ * They are not related to the time of day, thus windows like calendar days cannot be evaluated.
+ *
+ * \tparam ClockType is the clock the time points refer to
+ * \tparam BlockSize number of bytes available for the encoded intervals per block
+ * \tparam NumberOfBlocks number of blocks; must be at least 2
+ */
+template <class ClockType, std::size_t BlockSize = 64, std::size_t NumberOfBlocks = 4>
+class IntervalLog
+{
+  public:
+    /**
+     * Resolution of the stored intervals.
+     */
+    typedef std::chrono::seconds Duration;
+
+    /**
+     * Point in time of the clock in the resolution of \ref Duration.
+     */
+    typedef std::chrono::time_point<ClockType, Duration> TimePoint;
+
+    /**
+     * Appends an interval.
+     *
+     * Constant time.
+     * Intervals must be appended in chronological order.
+     * An interval which begins before the end of the previous one is shortened accordingly.
+     *
+     * \param begin start of the interval
+     * \param end end of the interval
+     */
+    void append(TimePoint begin, TimePoint end);
+
+    /**
+     * Sums up the recorded time within a window.
+     *
+     * Intervals which are partially inside the window are considered with the overlapping part only.
+     *
+     * \param from start of the window
+     * \param to end of the window
+     * \returns the recorded time within the window
+     */
+    Duration getDuration(TimePoint from, TimePoint to) const;
+
+    /**
+     * Gets the earliest point in time which is still covered by the history.
+     *
+     * Any time recorded before has been discarded due to limited space.
+     * \returns the begin of the oldest interval stored or nothing if no interval is stored
+     */
+    std::optional<TimePoint> getBegin() const;
+
+    /**
+     * \returns number of intervals stored
+     */
+    std::size_t size() const;
+
+  private:
+    static_assert(NumberOfBlocks >= 2);
+    static_assert(BlockSize <= UINT16_MAX);
+
+    /**
+     * Seconds since the epoch of the clock.
+     *
+     * Enough for 136 years.
+     */
+    typedef std::uint32_t Seconds;
+    static_assert(BlockSize >= 2 * maxVarintSize<Seconds>, "a block must be able to hold at least one interval");
+
+    struct Block
+    {
+        Seconds first;
+        Seconds last;
+        Seconds total;
+        std::uint16_t count;
+        std::uint16_t used;
+        std::array<std::uint8_t, BlockSize> data;
+    };
+
+    std::array<Block, NumberOfBlocks> blocks{};
+    std::size_t newest = 0;
+
+    static Seconds toSeconds(const TimePoint timePoint)
+    {
+        return static_cast<Seconds>(timePoint.time_since_epoch().count());
+    }
+
+    static Seconds getOverlap(Seconds begin, Seconds end, Seconds from, Seconds to)
+    {
+        begin = std::max(begin, from);
+        end = std::min(end, to);
+        return (end > begin) ? (end - begin) : 0;
+    }
+};
+
+template <class ClockType, std::size_t BlockSize, std::size_t NumberOfBlocks>
+void IntervalLog<ClockType, BlockSize, NumberOfBlocks>::append(const TimePoint begin, const TimePoint end)
+{
+    Block *block = &blocks[newest];
+    const Seconds previousEnd = (block->count > 0) ? block->last : toSeconds(begin);
+    const Seconds beginSeconds = std::max(toSeconds(begin), previousEnd);
+    const Seconds endSeconds = std::max(toSeconds(end), beginSeconds);
+
+    Seconds pause = beginSeconds - previousEnd;
+    const Seconds length = endSeconds - beginSeconds;
+    if (block->count > 0 && block->used + getVarintSize(pause) + getVarintSize(length) > BlockSize)
+    {
+        // continue with the oldest block, which gets discarded
+        newest = (newest + 1) % NumberOfBlocks;
+        block = &blocks[newest];
+        block->count = 0;
+        block->used = 0;
+        block->total = 0;
+        pause = 0;
+    }
+    if (block->count == 0)
+    {
+        block->first = beginSeconds;
+    }
+    std::uint8_t *const position = &block->data[block->used];
+    block->used = encodeVarint(length, encodeVarint(pause, position)) - block->data.data();
+    block->last = endSeconds;
+    block->total += length;
+    block->count++;
+}
+
+template <class ClockType, std::size_t BlockSize, std::size_t NumberOfBlocks>
+typename IntervalLog<ClockType, BlockSize, NumberOfBlocks>::Duration IntervalLog<ClockType, BlockSize, NumberOfBlocks>::getDuration(const TimePoint from, const TimePoint to) const
+{
+    const Seconds windowBegin = toSeconds(from);
+    const Seconds windowEnd = toSeconds(to);
+    Seconds sum = 0;
+    for (const Block &block : blocks)
+    {
+        if (block.count == 0 || block.last <= windowBegin || block.first >= windowEnd)
+        {
+            continue; // block is outside of the window
+        }
+        if (windowBegin <= block.first && block.last <= windowEnd)
+        {
+            sum += block.total; // block is completely inside of the window
+            continue;
+        }
+        const std::uint8_t *position = block.data.data();
+        const std::uint8_t *const end = position + block.used;
+        Seconds intervalEnd = block.first;
+        while (position != end)
+        {
+            Seconds pause;
+            Seconds length;
+            position = decodeVarint(position, end, pause);
+            position = decodeVarint(position, end, length);
+            const Seconds intervalBegin = intervalEnd + pause;
+            intervalEnd = intervalBegin + length;
+            if (intervalBegin >= windowEnd)
+            {
+                break;
+            }
+            sum += getOverlap(intervalBegin, intervalEnd, windowBegin, windowEnd);
+        }
+    }
+    return Duration(sum);
+}
+
+template <class ClockType, std::size_t BlockSize, std::size_t NumberOfBlocks>
+std::optional<typename IntervalLog<ClockType, BlockSize, NumberOfBlocks>::TimePoint> IntervalLog<ClockType, BlockSize, NumberOfBlocks>::getBegin() const
+{
+    // the block after the newest one is the oldest one
+    for (std::size_t age = 1; age <= NumberOfBlocks; ++age)
+    {
+        const Block &block = blocks[(newest + age) % NumberOfBlocks];
+        if (block.count > 0)
+        {
+            return TimePoint(Duration(block.first));
+        }
+    }
+    return std::nullopt;
+}
+
+template <class ClockType, std::size_t BlockSize, std::size_t NumberOfBlocks>
+std::size_t IntervalLog<ClockType, BlockSize, NumberOfBlocks>::size() const
+{
+    std::size_t count = 0;
+    for (const Block &block : blocks)
+    {
+        count += block.count;
+    }
+    return count;
+}
@@ -2,9 +2,21 @@
  * \file .
  */
 #pragma once
+#include "IntervalLog.hpp"
+#include <algorithm>
 #include <chrono>
-#include <map>
-#include <string>
+#include <flat_map.hpp>
+#include <inline_string.hpp>
+
+#ifndef TASK_LABEL_CAPACITY
+/**
+ * Maximum number of bytes of a task's label.
+ *
+ * Labels are UTF-8 encoded; a character may need up to 4 bytes.
+ * Longer labels are truncated.
+ */
+#define TASK_LABEL_CAPACITY 47
+#endif
 
 /**
  * Task ID.
@@ -17,8 +29,13 @@ typedef unsigned int TaskId;
  * A task consists of a label and a duration.
  * The duration is incremented while the task is running.
  * The duration is stored in seconds.
+ *
+ * \tparam ClockType is the clock used to measure durations.
+ *         Should be monotonic; a wall clock may jump when the time of day is set.
+ *         Meets the requirements of *Clock* (see `std::chrono::steady_clock`).
  */
-class Task
+template <class ClockType = std::chrono::steady_clock>
+class BasicTask
 {
   public:
     /**
@@ -33,12 +50,36 @@ class Task
     /**
      * String type used for labels of the task.
      *
+     * Stored inline to avoid a heap allocation per task.
+     *
      * \internal
      * Must be able to hold special non-ANSI characters.
      * \endinternal
      */
-    typedef std::string String;
-    Task(const String &newLabel, const Duration elapsedTime = Duration::zero());
+    typedef InlineString<TASK_LABEL_CAPACITY> String;
+
+    /**
+     * Clock used to measure durations.
+     *
+     * The clock's time points are only used to measure durations.
+     * They are not meant to be presented as time of day.
+     */
+    typedef ClockType Clock;
+
+    /**
+     * Point in time of \ref Clock.
+     */
+    typedef typename Clock::time_point TimePoint;
+
+    /**
+     * History of the intervals in which the task has been running.
+     *
+     * Holds at least the latest 12 intervals of minutes to hours and needs about 130 bytes per task.
+     * Refers to \ref Clock, is not persisted and thus starts empty after a restart.
+     */
+    typedef IntervalLog<Clock, 48, 2> History;
+
+    BasicTask(const String &newLabel, const Duration elapsedTime = Duration::zero());
 
     /**
      * Starts/continues capturing duration
@@ -47,13 +88,33 @@ class Task
      */
     void start();
 
+    /**
+     * Starts/continues capturing duration at a given point in time.
+     *
+     * Allows to start the task at the point in time the user has requested it,
+     * for example when a key has been pressed, instead of when the request is processed.
+     *
+     * \param at point in time from which the duration is captured
+     */
+    void start(TimePoint at);
+
     /**
      * Stops/pauses capturing duration.
      *
      * Sets the state of the task to "stopped".
+     * The interval since the start is appended to the history.
      * Has no effect if already stopped.
      */
     void stop();
+
+    /**
+     * Stops/pauses capturing duration at a given point in time.
+     *
+     * \see start(TimePoint)
+     * \param at point in time until which the duration is captured;
+     *           a point in time before the start is considered as the start
+     */
+    void stop(TimePoint at);
     const String &getLabel() const;
     void setLabel(const String &label);
 
@@ -61,13 +122,44 @@ class Task
      * Gets the recorded duration.
      * 
      * Does also consider an already begun interval if the task is running.
+     * Does not modify the task, reads the clock once.
      * 
      * \returns the accumulated duration
      */
-    Duration getRecordedDuration();
+    Duration getRecordedDuration() const;
+
+    /**
+     * Gets the duration recorded until a given point in time.
+     *
+     * Does also consider an already begun interval if the task is running.
+     * Allows to sample several tasks at the same instant.
+     *
+     * \param now the point in time up to which a running interval is considered;
+     *            must not be before the start of the running interval
+     * \returns the accumulated duration
+     */
+    Duration getRecordedDuration(TimePoint now) const;
 
     Duration getLastRecordedDuration() const;
 
+    /**
+     * Gets the duration recorded within a window of time.
+     *
+     * Does also consider an already begun interval if the task is running.
+     * Time which has been discarded from the history or which has been set
+     * using \ref setRecordedDuration() is not considered.
+     *
+     * \param from start of the window
+     * \param to end of the window
+     * \returns the recorded duration within the window, in the resolution of the history
+     */
+    Duration getRecordedDurationWithin(typename History::TimePoint from, typename History::TimePoint to) const;
+
+    /**
+     * \returns the intervals in which the task has been running
+     */
+    const History &getHistory() const;
+
     /**
      * Sets the recorded duration.
      *
@@ -90,17 +182,163 @@ class Task
      * Internal representation in order to reduce loss of precision.
      */
     typedef std::chrono::milliseconds DurationFraction;
+    static_assert(DurationFraction::max() >= std::chrono::duration<int, std::ratio<10 * 31'556'952>>(1), "must hold at least 10 years");
     DurationFraction recordedDuration;
-    typedef std::chrono::system_clock Clock;
     std::chrono::time_point<Clock, DurationFraction> timestampStart;
+    History history;
 };
 
+/**
+ * Task as used by the device application.
+ */
+typedef BasicTask<> Task;
+
+template <class ClockType>
+const typename BasicTask<ClockType>::String &BasicTask<ClockType>::getLabel() const
+{
+    return label;
+}
+
+template <class ClockType>
+BasicTask<ClockType>::BasicTask(const String &newLabel, const Duration elapsedTime)
+    : label(newLabel), state(State::IDLE), recordedDuration(elapsedTime)
+{
+}
+
+template <class ClockType>
+void BasicTask<ClockType>::start()
+{
+    start(Clock::now());
+}
+
+template <class ClockType>
+void BasicTask<ClockType>::start(const TimePoint at)
+{
+    timestampStart = std::chrono::round<DurationFraction>(at);
+    state = State::RUNNING;
+}
+
+template <class ClockType>
+void BasicTask<ClockType>::stop()
+{
+    stop(Clock::now());
+}
+
+template <class ClockType>
+void BasicTask<ClockType>::stop(const TimePoint at)
+{
+    // this check is necessary, as else the timestamp using for comparison will be invalid
+    if (state == State::RUNNING)
+    {
+        const TimePoint end = std::max<TimePoint>(at, timestampStart);
+        recordedDuration += std::chrono::duration_cast<DurationFraction>(end - timestampStart);
+        history.append(std::chrono::round<Duration>(timestampStart), std::chrono::round<Duration>(end));
+        state = State::IDLE;
+    }
+}
+
+template <class ClockType>
+bool BasicTask<ClockType>::isRunning() const
+{
+    return state == State::RUNNING;
+}
+
+template <class ClockType>
+void BasicTask<ClockType>::setLabel(const String &label)
+{
+    this->label = label;
+}
+
+template <class ClockType>
+typename BasicTask<ClockType>::Duration BasicTask<ClockType>::getRecordedDuration() const
+{
+    return getRecordedDuration(Clock::now());
+}
+
+template <class ClockType>
+typename BasicTask<ClockType>::Duration BasicTask<ClockType>::getRecordedDuration(const TimePoint now) const
+{
+    DurationFraction duration = recordedDuration;
+    if (isRunning())
+    {
+        duration += std::chrono::duration_cast<DurationFraction>(now - timestampStart);
+    }
+    return std::chrono::round<Duration>(duration);
+}
+
+template <class ClockType>
+void BasicTask<ClockType>::setRecordedDuration(Duration newDuration)
+{
+    recordedDuration = newDuration;
+}
+
+template <class ClockType>
+typename BasicTask<ClockType>::Duration BasicTask<ClockType>::getLastRecordedDuration() const
+{
+    return std::chrono::round<Duration>(recordedDuration);
+}
+
+template <class ClockType>
+typename BasicTask<ClockType>::Duration BasicTask<ClockType>::getRecordedDurationWithin(const typename History::TimePoint from, const typename History::TimePoint to) const
+{
+    Duration duration = history.getDuration(from, to);
+    if (isRunning())
+    {
+        const auto begin = std::max(std::chrono::round<Duration>(timestampStart), from);
+        const auto end = std::min(std::chrono::round<Duration>(Clock::now()), to);
+        if (end > begin)
+        {
+            duration += end - begin;
+        }
+    }
+    return duration;
+}
+
+template <class ClockType>
+const typename BasicTask<ClockType>::History &BasicTask<ClockType>::getHistory() const
+{
+    return history;
+}
+
+extern template class BasicTask<>;
+
 namespace device
 {
-typedef std::map<TaskId, Task> TaskCollection;
+/**
+ * Container for tasks identified by their ID.
+ *
+ * Iterates in ascending order of the IDs.
+ */
+typedef FlatMap<TaskId, Task> TaskCollection;
 
 /**
  * *The* collection of tasks to be used by the device application.
+ *
+ * Not synchronized: it is owned by the main loop and must only be accessed from there.
+ * Other contexts (like the handling of keys) pass their requests to the main loop using a queue.
  */
 extern TaskCollection tasks;
+
+/**
+ * Samples the recorded durations of all tasks at one single instant.
+ *
+ * The result is a consistent snapshot: running tasks are considered up to the same point in time.
+ * The clock is read only once.
+ *
+ * \tparam Collection a collection of tasks like \ref TaskCollection
+ * \tparam Visitor callable with the signature `void(TaskId, const Task &, Task::Duration)`
+ * \param tasks the tasks to sample
+ * \param visitor is called for each task in the order of iteration with the sampled duration
+ * \returns the point in time the durations have been sampled at
+ */
+template <class Collection, class Visitor>
+typename Collection::mapped_type::TimePoint sampleRecordedDurations(const Collection &tasks, Visitor &&visitor)
+{
+    const auto now = Collection::mapped_type::Clock::now();
+    for (const auto &[id, task] : tasks)
+    {
+        visitor(id, task, task.getRecordedDuration(now));
+    }
+    return now;
+}
 } // namespace device
@@ -0,0 +1,120 @@
+#include "GestureDetector.hpp"
+#include <algorithm>
+#include <type_traits.hpp>
+#include <utility>
+
+GestureDetector::GestureDetector(GestureHandler handler, const Configuration &configuration)
+    : handler(std::move(handler)), configuration(configuration)
+{
+}
+
+void GestureDetector::handle(const KeyEvent &event)
+{
+    // gestures which have been due before the event come first
+    poll(event.timestamp);
+    if (event.isPressed)
+    {
+        press(event.id, event.timestamp);
+    }
+    else
+    {
+        release(event.id, event.timestamp);
+    }
+}
+
+void GestureDetector::poll(const Clock::time_point now)
+{
+    if (!nextDeadline || now < *nextDeadline)
+    {
+        return;
+    }
+    nextDeadline.reset();
+    for (std::size_t index = 0; index < keys.size(); ++index)
+    {
+        KeyState &key = keys[index];
+        if (!key.pressedAt || key.isConsumed)
+        {
+            continue;
+        }
+        if (key.deadline <= now)
+        {
+            const KeyId id = static_cast<KeyId>(index);
+            if (key.isLongPress)
+            {
+                emit(KeyGesture::Type::REPEAT, id, key.deadline);
+            }
+            else
+            {
+                key.isLongPress = true;
+                emit(KeyGesture::Type::LONG_PRESS, id, *key.pressedAt);
+            }
+            // repetitions which have been missed are skipped
+            key.deadline = std::max(key.deadline + configuration.repeatInterval, now + configuration.repeatInterval);
+        }
+        scheduleDeadline(key.deadline);
+    }
+}
+
+std::optional<GestureDetector::Clock::time_point> GestureDetector::getNextDeadline() const
+{
+    return nextDeadline;
+}
+
+void GestureDetector::press(const KeyId id, const Clock::time_point timestamp)
+{
+    KeyState &key = getState(id);
+    key = {.pressedAt = timestamp, .deadline = timestamp + configuration.longPressTime, .isConsumed = false, .isLongPress = false};
+
+    if (chordCandidate && *chordCandidate != id)
+    {
+        KeyState &first = getState(*chordCandidate);
+        const bool isChord = first.pressedAt && !first.isConsumed && !first.isLongPress && timestamp - *first.pressedAt <= configuration.chordWindow;
+        if (isChord)
+        {
+            first.isConsumed = true;
+            key.isConsumed = true;
+            emit(KeyGesture::Type::CHORD, *chordCandidate, *first.pressedAt, id);
+            chordCandidate.reset();
+            return;
+        }
+    }
+    chordCandidate = id;
+    scheduleDeadline(key.deadline);
+}
+
+void GestureDetector::release(const KeyId id, const Clock::time_point timestamp)
+{
+    KeyState &key = getState(id);
+    if (!key.pressedAt)
+    {
+        return; // has been pressed before the detector has been started
+    }
+    if (!key.isConsumed && !key.isLongPress)
+    {
+        const bool isLong = timestamp - *key.pressedAt >= configuration.longPressTime;
+        emit(isLong ? KeyGesture::Type::LONG_PRESS : KeyGesture::Type::SHORT_PRESS, id, *key.pressedAt);
+    }
+    key.pressedAt.reset();
+    if (chordCandidate == id)
+    {
+        chordCandidate.reset();
+    }
+}
+
+GestureDetector::KeyState &GestureDetector::getState(const KeyId id)
+{
+    return keys.at(to_underlying(id));
+}
+
+void GestureDetector::emit(const KeyGesture::Type type, const KeyId key, const Clock::time_point timestamp, const KeyId otherKey)
+{
+    if (handler)
+    {
+        handler({.type = type, .key = key, .otherKey = otherKey, .timestamp = timestamp});
+    }
+}
+
+void GestureDetector::scheduleDeadline(const Clock::time_point deadline)
+{
+    nextDeadline = nextDeadline ? std::min(*nextDeadline, deadline) : deadline;
+}
@@ -0,0 +1,114 @@
+/**
+ * \file .
+ */
+#pragma once
+#include "KeyEvent.hpp"
+#include "KeyGesture.hpp"
+#include <array>
+#include <chrono>
+#include <functional>
+#include <optional>
+
+/**
+ * Recognizes gestures from debounced key events.
+ *
+ * Works on the timestamps of the events, not on the point in time they are processed.
+ * Thus the gestures do not depend on the latency of the processing.
+ *
+ * Each event is processed in constant time.
+ * Gestures which are recognized by elapsing time (long presses and their repetitions) are recognized by \ref poll(),
+ * which only compares against the next deadline unless it has elapsed.
+ */
+class GestureDetector
+{
+  public:
+    typedef KeyEvent::Clock Clock;
+    typedef std::function<void(const KeyGesture &)> GestureHandler;
+
+    struct Configuration
+    {
+        /**
+         * minimum time a key must be held to be recognized as long press
+         */
+        Clock::duration longPressTime;
+
+        /**
+         * time between repetitions while a key is held after a long press
+         */
+        Clock::duration repeatInterval;
+
+        /**
+         * maximum time between pressing two keys to be recognized as chord
+         */
+        Clock::duration chordWindow;
+    };
+
+    static constexpr Configuration defaultConfiguration = {
+        .longPressTime = std::chrono::milliseconds(800),
+        .repeatInterval = std::chrono::milliseconds(200),
+        .chordWindow = std::chrono::milliseconds(100),
+    };
+
+    /**
+     * \param handler is called for each recognized gesture
+     * \param configuration timing of the gestures
+     */
+    GestureDetector(GestureHandler handler, const Configuration &configuration = defaultConfiguration);
+
+    /**
+     * Processes a key event.
+     *
+     * Events must be passed in chronological order.
+     * \param event pressing or releasing a key
+     */
+    void handle(const KeyEvent &event);
+
+    /**
+     * Recognizes gestures which are due because time has elapsed.
+     *
+     * Must be called cyclically.
+     * \param now current point in time
+     */
+    void poll(Clock::time_point now);
+
+    /**
+     * Allows to sleep until \ref poll() needs to be called.
+     *
+     * The deadline of a key which has been released already may be returned; polling then recognizes nothing.
+     * \returns point in time at which the next gesture may be due, or nothing if no key is pressed
+     */
+    std::optional<Clock::time_point> getNextDeadline() const;
+
+  private:
+    struct KeyState
+    {
+        std::optional<Clock::time_point> pressedAt;
+
+        /**
+         * point in time of the next long press or repetition
+         */
+        Clock::time_point deadline;
+
+        /**
+         * true if the key has been used by a chord; no further gestures are recognized until it is released
+         */
+        bool isConsumed;
+        bool isLongPress;
+    };
+
+    GestureHandler handler;
+    Configuration configuration;
+    std::array<KeyState, static_cast<std::size_t>(KeyId::TASK4) + 1> keys{};
+
+    /**
+     * key which may become the first key of a chord
+     */
+    std::optional<KeyId> chordCandidate;
+    std::optional<Clock::time_point> nextDeadline;
+
+    void press(KeyId id, Clock::time_point timestamp);
+    void release(KeyId id, Clock::time_point timestamp);
+    KeyState &getState(KeyId id);
+    void emit(KeyGesture::Type type, KeyId key, Clock::time_point timestamp, KeyId otherKey = KeyId::NONE);
+    void scheduleDeadline(Clock::time_point deadline);
+};
@@ -1,16 +1,39 @@
 #pragma once
 #include "MenuItem.hpp"
 #include "user_interaction/IKeypad.hpp"
+#include <chrono>
 
 /**
  * Interface to a guiEngine capable of displaying various information to a human.
  *
  * This is used to implement the \ref plugin_architecture.
+ *
+ * Thread safety:
+ * - The methods must be called from one task only, the main loop.
+ * - Implementations may process the calls asynchronously in a task of their own.
+ *   Therefore, objects passed by pointer must stay valid and unchanged as long as the engine uses them.
+ * - Variables referenced by menu items are never accessed by the engine; it requests changes, see \ref IMenuItemVariable.
+ * - The keypad is read from the context of the engine; IKeypad::isKeyPressed() must be thread-safe.
  */
 class IGuiEngine
 {
   public:
+    /**
+     * \param keypad controls the GUI; must outlive the engine
+     */
     virtual void registerKeyPad(IKeypad *keypad) = 0;
-    virtual void refresh() = 0;
+
+    /**
+     * Processes pending work like animations, input devices and redrawing.
+     *
+     * Engines running in a task of their own refresh themselves.
+     *
+     * \returns the time until it needs to be called again at the latest
+     */
+    virtual std::chrono::milliseconds refresh() = 0;
+
+    /**
+     * \param menuList items of the menu to show; the list and its items must outlive the engine
+     */
     virtual void drawMenu(const MenuItemList *menuList) = 0;
 };
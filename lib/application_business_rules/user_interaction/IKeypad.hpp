@@ -1,19 +1,54 @@
 #pragma once
 
+#include "KeyEvent.hpp"
 #include "KeyIds.hpp"
+#include <cstddef>
 #include <functional>
 
-typedef std::function<void(KeyId)> HmiHandler;
+typedef std::function<void(const KeyEvent &)> HmiHandler;
 
 /**
  * Interface to an human input device.
  *
+ * Key events are detected in the background and queued.
+ * They are delivered by \ref processEvents() in the context of its caller.
+ *
  * This is used to implement the \ref plugin_architecture.
  */
 class IKeypad
 {
   public:
+    /**
+     * \param callbackFunction is called with the event of each key which has been pressed or released
+     */
     virtual void setCallback(const HmiHandler callbackFunction) = 0;
+
+    /**
+     * May be called from any task, as the GUI reads the keys in its own context.
+     *
+     * \returns true if the key is pressed currently
+     */
     virtual bool isKeyPressed(KeyId keyInquiry) = 0;
+
+    /**
+     * Sets a function which is called whenever an event has been queued.
+     *
+     * Allows to process the events as soon as they occur instead of polling for them.
+     * \param notification is called from the context which detects the events; must not block
+     */
+    virtual void setEventNotification(const std::function<void(void)> notification) = 0;
+
+    /**
+     * Delivers the queued key events to the callback in chronological order.
+     *
+     * Must be called cyclically, always from the same context.
+     */
+    virtual void processEvents() = 0;
+
+    /**
+     * \returns number of key events which have been dropped because too many were queued
+     */
+    virtual std::size_t getDroppedEvents() const = 0;
+
     virtual ~IKeypad(){};
 };
@@ -0,0 +1,25 @@
+#pragma once
+#include "KeyIds.hpp"
+#include <chrono>
+
+/**
+ * Debounced change of the state of a key.
+ */
+struct KeyEvent
+{
+    typedef std::chrono::steady_clock Clock;
+
+    KeyId id;
+
+    /**
+     * true if the key has been pressed, false if it has been released
+     */
+    bool isPressed;
+
+    /**
+     * point in time when the key has changed its state
+     *
+     * This is the first edge of the signal, not the point in time when the change has been debounced.
+     */
+    Clock::time_point timestamp;
+};
@@ -0,0 +1,50 @@
+#pragma once
+#include "KeyEvent.hpp"
+#include "KeyIds.hpp"
+#include <cstdint>
+
+/**
+ * Gesture performed with one or two keys.
+ */
+struct KeyGesture
+{
+    enum class Type : std::uint8_t
+    {
+        /**
+         * key has been released before the long press time
+         */
+        SHORT_PRESS,
+
+        /**
+         * key has been held for the long press time
+         */
+        LONG_PRESS,
+
+        /**
+         * key is still held after a long press
+         */
+        REPEAT,
+
+        /**
+         * a second key has been pressed shortly after the first one
+         */
+        CHORD,
+    };
+
+    Type type;
+
+    /**
+     * the key, or for chords the key which has been pressed first
+     */
+    KeyId key;
+
+    /**
+     * for chords, the key which has been pressed second; else \ref KeyId::NONE
+     */
+    KeyId otherKey;
+
+    /**
+     * point in time when the key has been pressed; for repetitions when the repetition has been due
+     */
+    KeyEvent::Clock::time_point timestamp;
+};
@@ -1,15 +1,20 @@
 #include "Menu.hpp"
 #include "MenuItem.hpp"
+#include <tasks/Task.hpp>
 
 /**
  * @brief Construct a new Menu:: Menu object
  * 
  * @param guiEngineToUse - GuiEngine to be used for display
  * @param keypad         - Keypad to get Menu controls from
+ * @param requestNotification - is called by the GUI whenever loop() needs to be called
  */
-Menu::Menu(IGuiEngine &guiEngineToUse, IKeypad &keypad)
+Menu::Menu(IGuiEngine &guiEngineToUse, IKeypad &keypad, const std::function<void(void)> requestNotification)
     : guiEngine(guiEngineToUse)
 {
+    taskList.setRequestNotification(requestNotification);
+    dashboard.setRequestNotification(requestNotification);
+
     /* register the Keypad to the GuiEngine for navigation */
     guiEngine.registerKeyPad(&keypad);
 
@@ -33,6 +38,8 @@ Menu::Menu(IGuiEngine &guiEngineToUse, IKeypad &keypad)
     mainMenu.push_back(&ListSwitch1);
     mainMenu.push_back(&ListSwitch2);
     mainMenu.push_back(&ListButton3);
+    mainMenu.push_back(&taskListItem);
+    mainMenu.push_back(&dashboardItem);
 
     /* define menu items for sub menu 1 */
     static auto Sub1Button1 = MenuItemSubmenu{"Sub1 Button1", &subMenu1};
@@ -55,6 +62,13 @@ Menu::Menu(IGuiEngine &guiEngineToUse, IKeypad &keypad)
     subMenu3.push_back(&Sub3Button1);
     subMenu3.push_back(&Sub3Button2);
 
+    /* the GUI changes the variables through the items, but they are written in loop() */
+    variables = {&ListValue, &ListSwitch1, &ListSwitch2};
+    for (IMenuItemVariable *const item : variables)
+    {
+        item->setRequestNotification(requestNotification);
+    }
+
     /* draw the main menu with GuiEngine */
     guiEngine.drawMenu(&mainMenu);
 }
@@ -63,7 +77,13 @@ Menu::Menu(IGuiEngine &guiEngineToUse, IKeypad &keypad)
  * @brief cyclic refresh function
  * 
  */
-void Menu::loop()
+std::chrono::milliseconds Menu::loop()
 {
-    guiEngine.refresh();
+    for (IMenuItemVariable *const item : variables)
+    {
+        item->synchronize();
+    }
+    taskList.update(device::tasks);
+    dashboard.update(device::tasks);
+    return guiEngine.refresh();
 }
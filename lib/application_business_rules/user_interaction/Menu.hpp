@@ -1,6 +1,12 @@
 #pragma once
 #include "IGuiEngine.hpp"
+#include "MenuItem.hpp"
+#include "TaskDashboard.hpp"
+#include "TaskListWindow.hpp"
 #include "user_interaction/IKeypad.hpp"
+#include <chrono>
+#include <functional>
+#include <vector>
 
 /**
  * @brief class to hold the menu structure of the HMI
@@ -9,9 +15,29 @@
 class Menu
 {
   public:
-    Menu(IGuiEngine &, IKeypad &keypad);
-    virtual void loop();
+    /**
+     * \param requestNotification is called by the GUI whenever loop() needs to be called, for example to scroll the task list
+     *                            or to update the dashboard;
+     *                            must not block
+     */
+    Menu(IGuiEngine &, IKeypad &keypad, std::function<void(void)> requestNotification = {});
+
+    /**
+     * Must be called from the context which owns the tasks.
+     *
+     * \returns the time until it needs to be called again at the latest
+     */
+    virtual std::chrono::milliseconds loop();
 
   private:
     IGuiEngine &guiEngine;
+    TaskListWindow taskList;
+    MenuItemTaskList taskListItem{"Tasks", &taskList};
+    TaskDashboard dashboard;
+    MenuItemDashboard dashboardItem{"Dashboard", &dashboard};
+
+    /**
+     * Items whose variables may be changed by the GUI.
+     */
+    std::vector<IMenuItemVariable *> variables;
 };
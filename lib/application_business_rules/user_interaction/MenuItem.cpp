@@ -1,4 +1,5 @@
 #include "MenuItem.hpp"
+#include <cmath>
 
 /**
  * @brief Construct a new MenuItemSubmenu:: MenuItemSubmenu object
@@ -36,7 +37,7 @@ const MenuItemList *MenuItemSubmenu::getSubMenuList() const
  * @param ptrBool   - pointer to the variable to be modified and shown
  */
 MenuItemSwitch::MenuItemSwitch(std::string text, bool *ptrBool)
-    : _text{text}, _ptrBool{ptrBool}
+    : _text{text}, _ptrBool{ptrBool}, _shared{ptrBool ? *ptrBool : false}
 {
 }
 
@@ -49,13 +50,50 @@ std::string MenuItemSwitch::getText() const
     return this->_text;
 }
 
+void MenuItemSwitch::setRequestNotification(std::function<void(void)> notification)
+{
+    this->_shared.setRequestNotification(notification);
+}
+
+void MenuItemSwitch::synchronize()
+{
+    if (this->_ptrBool == nullptr)
+    {
+        return;
+    }
+    if (const auto requested = this->_shared.takeRequest())
+    {
+        *this->_ptrBool = *requested;
+    }
+    this->_shared.show(*this->_ptrBool);
+}
+
 /**
- * @brief returns a pointer to the modification variable
+ * @brief returns whether the item refers to a variable which can be shown and changed
  * 
  */
-bool *MenuItemSwitch::getPtrBool() const
+bool MenuItemSwitch::hasVariable() const
 {
-    return this->_ptrBool;
+    return this->_ptrBool != nullptr;
+}
+
+/**
+ * @brief returns the value to be shown by the GUI
+ * 
+ */
+bool MenuItemSwitch::getValue() const
+{
+    return this->_shared.get();
+}
+
+/**
+ * @brief requests to change the variable; called by the GUI
+ * 
+ * @param value - new value of the variable
+ */
+void MenuItemSwitch::requestValue(const bool value) const
+{
+    this->_shared.request(value);
 }
 
 /**
@@ -68,7 +106,8 @@ bool *MenuItemSwitch::getPtrBool() const
  * @param max       - maximum value
  */
 MenuItemValue::MenuItemValue(std::string text, double *ptrDouble, uint8_t decimals, double min, double max)
-    : _text{text}, _ptrDouble{ptrDouble}, _decimals{decimals}, _min{min}, _max{max}
+    : _text{text}, _ptrDouble{ptrDouble}, _decimals{decimals}, _min{min}, _max{max},
+      _shared{ptrDouble ? toFixedPoint(*ptrDouble) : 0}
 {
 }
 
@@ -81,13 +120,60 @@ std::string MenuItemValue::getText() const
     return this->_text;
 }
 
+void MenuItemValue::setRequestNotification(std::function<void(void)> notification)
+{
+    this->_shared.setRequestNotification(notification);
+}
+
+void MenuItemValue::synchronize()
+{
+    if (this->_ptrDouble == nullptr)
+    {
+        return;
+    }
+    if (const auto requested = this->_shared.takeRequest())
+    {
+        *this->_ptrDouble = fromFixedPoint(*requested);
+    }
+    this->_shared.show(toFixedPoint(*this->_ptrDouble));
+}
+
 /**
- * @brief returns a pointer to the modification variable
+ * @brief returns whether the item refers to a variable which can be shown and changed
  * 
  */
-double *MenuItemValue::getPtrDouble() const
+bool MenuItemValue::hasVariable() const
+{
+    return this->_ptrDouble != nullptr;
+}
+
+/**
+ * @brief returns the value to be shown by the GUI, rounded to the decimals
+ * 
+ */
+double MenuItemValue::getValue() const
+{
+    return fromFixedPoint(this->_shared.get());
+}
+
+/**
+ * @brief requests to change the variable; called by the GUI
+ * 
+ * @param value - new value of the variable; rounded to the decimals
+ */
+void MenuItemValue::requestValue(const double value) const
+{
+    this->_shared.request(toFixedPoint(value));
+}
+
+std::int32_t MenuItemValue::toFixedPoint(const double value) const
+{
+    return static_cast<std::int32_t>(std::lround(value * std::pow(10, this->_decimals)));
+}
+
+double MenuItemValue::fromFixedPoint(const std::int32_t value) const
 {
-    return this->_ptrDouble;
+    return value / std::pow(10, this->_decimals);
 }
 
 /**
@@ -116,3 +202,61 @@ double MenuItemValue::getMax() const
 {
     return this->_max;
 }
+
+/**
+ * @brief Construct a new Menu Item Task List:: Menu Item Task List object
+ * 
+ * @param text      - text to be shown on the button
+ * @param window    - provides the visible rows of the list
+ */
+MenuItemTaskList::MenuItemTaskList(std::string text, TaskListWindow *window)
+    : _text{text}, _window{window}
+{
+}
+
+/**
+ * @brief returns the text of this item
+ * 
+ */
+std::string MenuItemTaskList::getText() const
+{
+    return this->_text;
+}
+
+/**
+ * @brief returns a pointer to the window of the list
+ * 
+ */
+TaskListWindow *MenuItemTaskList::getWindow() const
+{
+    return this->_window;
+}
+
+/**
+ * @brief Construct a new Menu Item Dashboard:: Menu Item Dashboard object
+ * 
+ * @param text      - text to be shown on the button
+ * @param dashboard - provides the running tasks
+ */
+MenuItemDashboard::MenuItemDashboard(std::string text, TaskDashboard *dashboard)
+    : _text{text}, _dashboard{dashboard}
+{
+}
+
+/**
+ * @brief returns the text of this item
+ * 
+ */
+std::string MenuItemDashboard::getText() const
+{
+    return this->_text;
+}
+
+/**
+ * @brief returns a pointer to the dashboard providing the running tasks
+ * 
+ */
+TaskDashboard *MenuItemDashboard::getDashboard() const
+{
+    return this->_dashboard;
+}
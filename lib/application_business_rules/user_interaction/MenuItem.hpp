@@ -1,5 +1,9 @@
 #pragma once
+#include "MenuVariable.hpp"
+#include "TaskDashboard.hpp"
+#include "TaskListWindow.hpp"
 #include <cstdint>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -12,6 +16,8 @@ enum class MenuItemType
     SUBMENU,
     SWITCH,
     VALUE,
+    TASK_LIST,
+    DASHBOARD,
 };
 
 /**
@@ -28,6 +34,28 @@ class IMenuItem
     virtual MenuItemType getType() const = 0;
 };
 
+/**
+ * @brief interface for menu items which show and change a variable of the application
+ * @note  The GUI only works on a \ref MenuVariable "copy" of the variable.
+ *        Changes are written to the variable by synchronize() in the context which owns it.
+ * 
+ */
+class IMenuItemVariable : public IMenuItem
+{
+  public:
+    /**
+     * \param notification is called from the GUI context whenever a change has been requested; must not block
+     */
+    virtual void setRequestNotification(std::function<void(void)> notification) = 0;
+
+    /**
+     * Writes a change requested by the GUI to the variable and shows changes of the variable.
+     *
+     * Must be called cyclically from the context which owns the variable.
+     */
+    virtual void synchronize() = 0;
+};
+
 /**
  * @brief type definition for a list of menu items
  * @note this is used for definition of menus
@@ -62,7 +90,7 @@ class MenuItemSubmenu final : public IMenuItem
  * @brief menu item to show and change boolean variables
  * 
  */
-struct MenuItemSwitch final : public IMenuItem
+struct MenuItemSwitch final : public IMenuItemVariable
 {
   public:
     MenuItemSwitch(std::string text, bool *ptrBool);
@@ -74,18 +102,28 @@ struct MenuItemSwitch final : public IMenuItem
         return MenuItemType::SWITCH;
     };
 
-    bool *getPtrBool() const;
+    void setRequestNotification(std::function<void(void)> notification) override;
+    void synchronize() override;
+
+    bool hasVariable() const;
+    bool getValue() const;
+    void requestValue(bool value) const;
 
   protected:
     const std::string _text;
     bool *_ptrBool;
+
+    /**
+     * the GUI requests changes through the items, which are constant for it
+     */
+    mutable MenuVariable<bool> _shared;
 };
 
 /**
  * @brief menu item to show double variables and call a modification screen
  * 
  */
-struct MenuItemValue final : public IMenuItem
+struct MenuItemValue final : public IMenuItemVariable
 {
   public:
     MenuItemValue(std::string text, double *ptrDouble, std::uint8_t decimals, double min, double max);
@@ -97,7 +135,12 @@ struct MenuItemValue final : public IMenuItem
         return MenuItemType::VALUE;
     };
 
-    double *getPtrDouble() const;
+    void setRequestNotification(std::function<void(void)> notification) override;
+    void synchronize() override;
+
+    bool hasVariable() const;
+    double getValue() const;
+    void requestValue(double value) const;
     std::uint8_t getDecimals() const;
     double getMin() const;
     double getMax() const;
@@ -108,4 +151,58 @@ struct MenuItemValue final : public IMenuItem
     std::uint8_t _decimals;
     double _min;
     double _max;
+
+    /**
+     * the value with the given decimals as integer, as a double is not lock-free on all targets
+     */
+    mutable MenuVariable<std::int32_t> _shared;
+
+    std::int32_t toFixedPoint(double value) const;
+    double fromFixedPoint(std::int32_t value) const;
+};
+
+/**
+ * @brief menu item to call a scrollable list of all tasks
+ * 
+ */
+struct MenuItemTaskList final : public IMenuItem
+{
+  public:
+    MenuItemTaskList(std::string text, TaskListWindow *window);
+    ~MenuItemTaskList() override = default;
+
+    std::string getText() const override;
+    inline MenuItemType getType() const override
+    {
+        return MenuItemType::TASK_LIST;
+    };
+
+    TaskListWindow *getWindow() const;
+
+  protected:
+    const std::string _text;
+    TaskListWindow *_window;
+};
+
+/**
+ * @brief menu item to call a dashboard of the running tasks
+ * 
+ */
+struct MenuItemDashboard final : public IMenuItem
+{
+  public:
+    MenuItemDashboard(std::string text, TaskDashboard *dashboard);
+    ~MenuItemDashboard() override = default;
+
+    std::string getText() const override;
+    inline MenuItemType getType() const override
+    {
+        return MenuItemType::DASHBOARD;
+    };
+
+    TaskDashboard *getDashboard() const;
+
+  protected:
+    const std::string _text;
+    TaskDashboard *_dashboard;
 };
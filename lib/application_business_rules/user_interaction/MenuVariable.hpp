@@ -0,0 +1,101 @@
+/**
+ * \file .
+ */
+#pragma once
+#include <atomic>
+#include <functional>
+#include <optional>
+
+/**
+ * Copy of a variable of the application, which is shown and changed by the GUI.
+ *
+ * The GUI never accesses the variable of the application itself.
+ * It reads the copy and requests changes; the latest request wins.
+ * The owner of the variable applies the requested change and publishes the value of the variable.
+ * Both are lock-free, thus \p T must be small enough for lock-free atomics.
+ *
+ * The GUI and the owner of the variable may run in different contexts:
+ * - get() and request() must be called from the GUI context only
+ * - takeRequest() and show() must be called from the context which owns the variable
+ */
+template <class T>
+class MenuVariable
+{
+  public:
+    static_assert(std::atomic<T>::is_always_lock_free, "the GUI must not be blocked by the owner of the variable");
+
+    /**
+     * \param initialValue of the variable
+     */
+    explicit MenuVariable(const T initialValue) : shown(initialValue), requested(initialValue)
+    {
+    }
+
+    /**
+     * Sets a function which is called whenever a change has been requested.
+     *
+     * Allows the owner of the variable to apply the change as soon as possible instead of polling.
+     * \param notification is called from the GUI context; must not block
+     */
+    void setRequestNotification(const std::function<void(void)> notification)
+    {
+        requestNotification = notification;
+    }
+
+    /**
+     * \returns the value to be shown
+     */
+    T get() const
+    {
+        return shown.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Requests to change the variable.
+     *
+     * The new value is shown immediately.
+     * \param value new value of the variable
+     */
+    void request(const T value)
+    {
+        shown.store(value, std::memory_order_relaxed);
+        requested.store(value, std::memory_order_relaxed);
+        isRequested.store(true, std::memory_order_release);
+        if (requestNotification)
+        {
+            requestNotification();
+        }
+    }
+
+    /**
+     * \returns the value requested by the GUI, if any has been requested since the last call
+     */
+    std::optional<T> takeRequest()
+    {
+        if (!isRequested.exchange(false, std::memory_order_acq_rel))
+        {
+            return std::nullopt;
+        }
+        return requested.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Publishes the value of the variable to the GUI.
+     *
+     * Is ignored while a change is pending, so the GUI does not show the outdated value meanwhile.
+     * \param value current value of the variable
+     */
+    void show(const T value)
+    {
+        if (!isRequested.load(std::memory_order_acquire))
+        {
+            shown.store(value, std::memory_order_relaxed);
+        }
+    }
+
+  private:
+    std::atomic<T> shown;
+    std::atomic<T> requested;
+    std::atomic<bool> isRequested{false};
+    std::function<void(void)> requestNotification;
+};
@@ -36,7 +36,7 @@ Presenter::Presenter(Menu &menuToUse, const std::vector<IStatusIndicator *> &sta
     board::setup();
 }
 
-void Presenter::loop()
+std::chrono::milliseconds Presenter::loop()
 {
-    menu.loop();
+    return menu.loop();
 }
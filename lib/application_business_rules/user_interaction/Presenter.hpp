@@ -2,6 +2,7 @@
 #include "IPresenter.hpp"
 #include "IStatusIndicator.hpp"
 #include "Menu.hpp"
+#include <chrono>
 #include <vector>
 
 class Presenter : public IPresenter
@@ -9,7 +10,11 @@ class Presenter : public IPresenter
   public:
     Presenter(Menu &, const std::vector<IStatusIndicator *> &);
     void setTaskStatusIndicator(const TaskIndex, const TaskIndicatorState) override;
-    void loop();
+
+    /**
+     * \returns the time until it needs to be called again at the latest
+     */
+    std::chrono::milliseconds loop();
 
   private:
     Menu &menu;
@@ -1,27 +1,19 @@
 #include "ProcessHmiInputs.hpp"
+#include "GestureDetector.hpp"
 #include "IKeypad.hpp"
 #include "IPresenter.hpp"
+#include "TaskKeyBindings.hpp"
 #include "board_interface.hpp"
+#include <algorithm>
+#include <chrono>
 #include <functional>
 #include <serial_interface/serial_port.hpp>
 #include <stdexcept>
+#include <storage/TaskJournal.hpp>
+#include <string>
 #include <tasks/Task.hpp>
 #include <type_traits.hpp>
 
-static Task *mapTaskSelectionToTask(const KeyId taskSelection)
-{
-    // TODO lookup which task selection belongs to which task object
-    const std::size_t taskIndex = to_underlying(taskSelection) - to_underlying(KeyId::TASK1);
-    if (taskIndex < device::tasks.size())
-    {
-        return &(std::next(std::begin(device::tasks), taskIndex)->second);
-    }
-    else
-    {
-        return nullptr;
-    }
-}
-
 static TaskIndex mapTaskToStatusIndicator(const KeyId selection)
 {
     switch (selection)
@@ -44,58 +36,173 @@ static TaskIndex mapTaskToStatusIndicator(const KeyId selection)
     }
 }
 
-void ProcessHmiInputs::handleHmiSelection(const KeyId selection)
+std::chrono::milliseconds ProcessHmiInputs::loop()
 {
-    serial_port::cout << "Handle event nr. " << to_underlying(selection) << std::endl;
-    switch (selection)
+    // keys may have been bound or tasks deleted by commands
+    if (shownBindingsRevision != device::taskKeyBindings.getRevision() || shownTasksRevision != device::tasks.revision())
     {
-    case KeyId::TASK1:
-    case KeyId::TASK2:
-    case KeyId::TASK3:
-    case KeyId::TASK4: {
-        Task *const optTask = mapTaskSelectionToTask(selection);
-        if (optTask)
+        showTaskStates();
+    }
+
+    const auto now = KeyEvent::Clock::now();
+    gestures.poll(now);
+    const auto deadline = gestures.getNextDeadline();
+    if (!deadline)
+    {
+        return std::chrono::milliseconds::max();
+    }
+    // rounded up, as waking up before the deadline does not recognize the gesture
+    return std::max(std::chrono::ceil<std::chrono::milliseconds>(*deadline - now), std::chrono::milliseconds::zero());
+}
+
+static bool isTaskKey(const KeyId key)
+{
+    return key == KeyId::TASK1 || key == KeyId::TASK2 || key == KeyId::TASK3 || key == KeyId::TASK4;
+}
+
+void ProcessHmiInputs::handleHmiSelection(const KeyGesture &gesture)
+{
+    switch (gesture.type)
+    {
+    case KeyGesture::Type::SHORT_PRESS:
+        if (isTaskKey(gesture.key))
         {
-            Task &task = *optTask;
-            if (task.isRunning())
-            {
-                task.stop();
-            }
-            else
-            {
-                task.start();
-            }
-            stateVisualizer.setTaskStatusIndicator(
-                mapTaskToStatusIndicator(selection),
-                task.isRunning() ? TaskIndicatorState::ACTIVE : TaskIndicatorState::INACTIVE);
+            toggleTask(gesture.key, gesture.timestamp);
         }
-        else
+        break;
+    case KeyGesture::Type::LONG_PRESS:
+        if (isTaskKey(gesture.key))
         {
-            serial_port::cout << "No task assigned to selection " << to_underlying(selection) << std::endl;
+            focusTask(gesture.key, gesture.timestamp);
         }
         break;
-    }
-    default:
+    case KeyGesture::Type::CHORD:
+        // chords have no action of their own; each task key acts as if it had been pressed alone
+        for (const KeyId key : {gesture.key, gesture.otherKey})
+        {
+            if (isTaskKey(key))
+            {
+                toggleTask(key, gesture.timestamp);
+            }
+        }
+        break;
+    case KeyGesture::Type::REPEAT:
         break;
     }
 }
 
+void ProcessHmiInputs::setTaskState(const TaskId id, Task &task, const bool isRunning, const Task::TimePoint at)
+{
+    if (task.isRunning() == isRunning)
+    {
+        return;
+    }
+    if (isRunning)
+    {
+        task.start(at);
+        device::journal.recordStart(id);
+    }
+    else
+    {
+        task.stop(at);
+        device::journal.recordStop(id, task);
+    }
+}
+
+void ProcessHmiInputs::showTaskStates()
+{
+    for (const KeyId key : {KeyId::TASK1, KeyId::TASK2, KeyId::TASK3, KeyId::TASK4})
+    {
+        showTaskState(key);
+    }
+    shownBindingsRevision = device::taskKeyBindings.getRevision();
+    shownTasksRevision = device::tasks.revision();
+}
+
+void ProcessHmiInputs::showTaskState(const KeyId selection)
+{
+    const Task *const task = device::taskKeyBindings.getTask(selection);
+    const TaskIndex index = mapTaskToStatusIndicator(selection);
+    const TaskIndicatorState state = (task && task->isRunning()) ? TaskIndicatorState::ACTIVE : TaskIndicatorState::INACTIVE;
+    if (shownStates.at(index) != state)
+    {
+        stateVisualizer.setTaskStatusIndicator(index, state);
+        shownStates.at(index) = state;
+    }
+}
+
+void ProcessHmiInputs::toggleTask(const KeyId selection, const Task::TimePoint at)
+{
+    Task *const task = device::taskKeyBindings.getTask(selection);
+    if (task)
+    {
+        setTaskState(device::taskKeyBindings.getTaskId(selection).value(), *task, !task->isRunning(), at);
+        showTaskState(selection);
+    }
+    else
+    {
+        serial_port::cout << "No task assigned to selection " << to_underlying(selection) << std::endl;
+    }
+}
+
+void ProcessHmiInputs::focusTask(const KeyId selection, const Task::TimePoint at)
+{
+    Task *const focusedTask = device::taskKeyBindings.getTask(selection);
+    if (!focusedTask)
+    {
+        serial_port::cout << "No task assigned to selection " << to_underlying(selection) << std::endl;
+        return;
+    }
+    // also the tasks which are not bound to a key, for example those started by a command
+    for (auto &[id, task] : device::tasks)
+    {
+        if (&task != focusedTask)
+        {
+            setTaskState(id, task, false, at);
+        }
+    }
+    setTaskState(device::taskKeyBindings.getTaskId(selection).value(), *focusedTask, true, at);
+    showTaskStates();
+}
+
+static_assert(TaskKeyBindings::numberOfKeys <= TaskJournal::numberOfBindings, "the assignment of each task key must be persisted");
+
 template <class CONTAINER>
 static void initializeTasks(CONTAINER &tasks)
 {
-    // TODO get tasks from storage
+    // the tasks have been restored from storage already; provide some tasks at the very first start only
+    if (!device::journal.isInitialized())
+    {
+        for (const TaskId id : {31, 32, 33, 34})
+        {
+            const auto element = tasks.try_emplace(id, "Task " + std::to_string(id - 30)).first;
+            device::journal.recordAdd(element->first, element->second);
+        }
+        for (std::size_t key = 0; key < TaskKeyBindings::numberOfKeys; ++key)
+        {
+            device::journal.recordBind(key, static_cast<TaskId>(31 + key));
+        }
+        device::journal.recordInitialization();
+    }
 
-    // workaround for missing storage: initialize dummy tasks
-    device::tasks.emplace(31, "Task 1");
-    device::tasks.emplace(32, "Task 2");
-    device::tasks.emplace(33, "Task 3");
-    device::tasks.emplace(34, "Task 4");
+    const auto bindings = device::journal.getBindings();
+    for (std::size_t key = 0; key < TaskKeyBindings::numberOfKeys; ++key)
+    {
+        const auto keyId = static_cast<KeyId>(to_underlying(KeyId::TASK1) + key);
+        if (bindings[key])
+        {
+            device::taskKeyBindings.bind(keyId, *bindings[key]);
+        }
+    }
 }
 
 ProcessHmiInputs::ProcessHmiInputs(IPresenter &stateVisualizer, IKeypad &keypad)
-    : stateVisualizer(stateVisualizer)
+    : stateVisualizer(stateVisualizer), gestures(std::bind(&ProcessHmiInputs::handleHmiSelection, this, std::placeholders::_1))
 {
-    using namespace std::placeholders;
-    keypad.setCallback(std::bind(&ProcessHmiInputs::handleHmiSelection, this, _1));
+    shownStates.fill(TaskIndicatorState::INACTIVE);
+    keypad.setCallback(std::bind(&GestureDetector::handle, &gestures, std::placeholders::_1));
     initializeTasks(device::tasks);
+
+    // tasks which have been running before a restart are running again after restoring them; only those are shown
+    showTaskStates();
 }
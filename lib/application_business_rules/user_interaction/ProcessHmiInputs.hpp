@@ -1,7 +1,13 @@
 #pragma once
-#include "KeyIds.hpp"
+#include "GestureDetector.hpp"
+#include "KeyEvent.hpp"
+#include "KeyGesture.hpp"
+#include "IPresenter.hpp"
+#include "TaskKeyBindings.hpp"
+#include <array>
+#include <chrono>
+#include <tasks/Task.hpp>
 
-class IPresenter;
 class IKeypad;
 
 /**
@@ -10,6 +16,16 @@ class IKeypad;
  * Inputs from human interface devices will be processed using the application logic.
  * The \ref Presenter is used to feedback information back to the human user.
  *
+ * The keypad queues the key events and delivers them by \ref IKeypad::processEvents().
+ * That must be called in the context which owns the tasks, like \ref loop().
+ *
+ * Key events are interpreted as gestures by a \ref GestureDetector:
+ * - a short press of a task key starts or stops the task
+ * - a long press of a task key starts the task and stops all other tasks
+ * - two keys pressed at once (a chord) act like a short press of each of them
+ *
+ * The tasks are started and stopped at the point in time when the key has been pressed.
+ *
  * \dotfile presenter_collaboration.dot "information flow using the Presenter"
  */
 class ProcessHmiInputs
@@ -17,7 +33,39 @@ class ProcessHmiInputs
   public:
     ProcessHmiInputs(IPresenter &stateVisualizer, IKeypad &keypad);
 
+    /**
+     * Recognizes gestures which depend on elapsed time, like long presses.
+     *
+     * Must be called cyclically from the context which owns the tasks.
+     *
+     * \returns the time until it needs to be called again at the latest
+     */
+    std::chrono::milliseconds loop();
+
   private:
     IPresenter &stateVisualizer;
-    void handleHmiSelection(const KeyId selection);
+    GestureDetector gestures;
+    void handleHmiSelection(const KeyGesture &gesture);
+    void setTaskState(TaskId id, Task &task, bool isRunning, Task::TimePoint at);
+
+    /**
+     * Revisions of the key bindings and of the tasks shown by the status indicators.
+     */
+    std::size_t shownBindingsRevision = 0;
+    std::size_t shownTasksRevision = 0;
+
+    /**
+     * States shown by the status indicators of the task keys; the indicators are off at start.
+     */
+    std::array<TaskIndicatorState, TaskKeyBindings::numberOfKeys> shownStates;
+
+    /**
+     * Shows on the status indicator of a task key whether its task is running.
+     *
+     * The presenter is only called if the state has changed, as it signals each change with a tone.
+     */
+    void showTaskState(KeyId selection);
+    void showTaskStates();
+    void toggleTask(KeyId selection, Task::TimePoint at);
+    void focusTask(KeyId selection, Task::TimePoint at);
 };
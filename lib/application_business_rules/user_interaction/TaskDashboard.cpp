@@ -0,0 +1,57 @@
+#include "TaskDashboard.hpp"
+
+void TaskDashboard::setRequestNotification(const std::function<void(void)> notification)
+{
+    requestNotification = notification;
+}
+
+void TaskDashboard::request()
+{
+    requested.store(true, std::memory_order_release);
+    if (requestNotification)
+    {
+        requestNotification();
+    }
+}
+
+std::optional<TaskDashboard::Snapshot> TaskDashboard::takeSnapshot()
+{
+    std::optional<Snapshot> latest;
+    while (auto snapshot = snapshots.pop())
+    {
+        latest = snapshot;
+    }
+    return latest;
+}
+
+void TaskDashboard::update(const device::TaskCollection &tasks)
+{
+    if (!requested.exchange(false, std::memory_order_acq_rel))
+    {
+        return;
+    }
+
+    Snapshot snapshot{};
+    snapshot.sampledAt = device::sampleRecordedDurations(tasks, [&snapshot](const TaskId id, const Task &task, const Task::Duration duration) {
+        if (!task.isRunning())
+        {
+            return;
+        }
+        if (snapshot.numberOfRows < maximumRows)
+        {
+            snapshot.rows[snapshot.numberOfRows] = {
+                .id = id,
+                .label = task.getLabel(),
+                .duration = duration,
+            };
+            ++snapshot.numberOfRows;
+        }
+        ++snapshot.numberOfRunningTasks;
+    });
+
+    // if the queue is full, the snapshot is taken again by one of the next updates
+    if (!snapshots.push(snapshot))
+    {
+        requested.store(true, std::memory_order_release);
+    }
+}
@@ -0,0 +1,82 @@
+/**
+ * \file .
+ */
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <spsc_queue.hpp>
+#include <tasks/Task.hpp>
+
+/**
+ * Running tasks with their recorded durations, for a dashboard on the display.
+ *
+ * The GUI requests a snapshot whenever it updates the dashboard, which is about once per second.
+ * The snapshot is taken by \ref update() in the context which owns the tasks and passed as a copy through a lock-free queue.
+ * Each snapshot carries the point in time it has been sampled at.
+ * The GUI advances the durations by the time passed since then, no matter how long the snapshot has been queued.
+ *
+ * The GUI and the owner of the tasks may run in different contexts:
+ * - request() and takeSnapshot() must be called from the GUI context only
+ * - update() must be called cyclically from the context which owns the tasks
+ */
+class TaskDashboard
+{
+  public:
+    /**
+     * Maximum number of running tasks shown at once.
+     */
+    static constexpr std::size_t maximumRows = 5;
+
+    struct Row
+    {
+        TaskId id;
+        Task::String label;
+        Task::Duration duration;
+    };
+
+    /**
+     * Running tasks, sampled at one instant.
+     */
+    struct Snapshot
+    {
+        std::size_t numberOfRunningTasks; ///< may be more than the rows
+        std::size_t numberOfRows;
+        std::array<Row, maximumRows> rows; ///< the first running tasks, in the order of the collection
+        Task::TimePoint sampledAt;         ///< the durations are recorded up to this point in time
+    };
+
+    /**
+     * Sets a function which is called whenever a snapshot has been requested.
+     *
+     * Allows the owner of the tasks to call update() as soon as possible instead of polling.
+     * \param notification is called from the GUI context; must not block
+     */
+    void setRequestNotification(const std::function<void(void)> notification);
+
+    /**
+     * Requests a snapshot of the running tasks.
+     */
+    void request();
+
+    /**
+     * \returns the latest snapshot which has been delivered since the last call, if any
+     */
+    std::optional<Snapshot> takeSnapshot();
+
+    /**
+     * Delivers a snapshot, if one has been requested.
+     *
+     * Visits all tasks once per request, but does not allocate memory.
+     * \param tasks the tasks to show
+     */
+    void update(const device::TaskCollection &tasks);
+
+  private:
+    std::atomic<bool> requested{false};
+    std::function<void(void)> requestNotification;
+
+    SpscQueue<Snapshot, 2> snapshots;
+};
@@ -0,0 +1,71 @@
+#include "TaskKeyBindings.hpp"
+#include <type_traits.hpp>
+
+TaskKeyBindings::TaskKeyBindings(device::TaskCollection &tasks)
+    : tasks(tasks)
+{
+    bindings.fill({std::nullopt, nullptr, 0});
+}
+
+std::optional<std::size_t> TaskKeyBindings::toIndex(const KeyId key)
+{
+    switch (key)
+    {
+    case KeyId::TASK1:
+    case KeyId::TASK2:
+    case KeyId::TASK3:
+    case KeyId::TASK4:
+        return to_underlying(key) - to_underlying(KeyId::TASK1);
+    default:
+        return std::nullopt;
+    }
+}
+
+void TaskKeyBindings::resolve(Binding &binding)
+{
+    const auto element = binding.id ? tasks.find(*binding.id) : tasks.end();
+    binding.task = (element != tasks.end()) ? &element->second : nullptr;
+    binding.revision = tasks.revision();
+}
+
+bool TaskKeyBindings::bind(const KeyId key, const TaskId id)
+{
+    const auto index = toIndex(key);
+    if (!index)
+    {
+        return false;
+    }
+    Binding &binding = bindings[*index];
+    binding.id = id;
+    resolve(binding);
+    revision++;
+    return true;
+}
+
+std::optional<TaskId> TaskKeyBindings::getTaskId(const KeyId key) const
+{
+    const auto index = toIndex(key);
+    return index ? bindings[*index].id : std::nullopt;
+}
+
+Task *TaskKeyBindings::getTask(const KeyId key)
+{
+    const auto index = toIndex(key);
+    if (!index)
+    {
+        return nullptr;
+    }
+    Binding &binding = bindings[*index];
+    if (binding.revision != tasks.revision())
+    {
+        resolve(binding);
+    }
+    return binding.task;
+}
+
+std::size_t TaskKeyBindings::getRevision() const
+{
+    return revision;
+}
+
+TaskKeyBindings device::taskKeyBindings(device::tasks);
@@ -0,0 +1,85 @@
+/**
+ * \file .
+ */
+#pragma once
+#include "KeyIds.hpp"
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <tasks/Task.hpp>
+
+/**
+ * Assigns tasks to the task keys of the keypad.
+ *
+ * A task key stays bound to the same task ID when other tasks are added or deleted.
+ *
+ * Resolving a key to its task is constant time in the number of tasks:
+ * The resolved task is cached and only looked up again after the task collection has been modified.
+ */
+class TaskKeyBindings
+{
+  public:
+    /**
+     * Number of keys which can be bound to tasks.
+     */
+    static constexpr std::size_t numberOfKeys = 4;
+
+    /**
+     * Creates a table with no key bound.
+     * \param tasks is the collection to resolve the task IDs in
+     */
+    TaskKeyBindings(device::TaskCollection &tasks);
+
+    /**
+     * Binds a task key to a task.
+     *
+     * The task does not need to exist (yet).
+     * \param key the task key to bind
+     * \param id of the task to assign to the key
+     * \retval true if the key has been bound
+     * \retval false if the key is not a task key
+     */
+    bool bind(KeyId key, TaskId id);
+
+    /**
+     * \returns the ID of the task which is bound to the key, if any
+     */
+    std::optional<TaskId> getTaskId(KeyId key) const;
+
+    /**
+     * Resolves a task key to the task.
+     *
+     * \returns pointer to the bound task or `nullptr` if the key is not bound or the task does not exist
+     */
+    Task *getTask(KeyId key);
+
+    /**
+     * Allows to detect changes of the assignment without comparing all keys.
+     *
+     * \returns a number which changes whenever a key is bound
+     */
+    std::size_t getRevision() const;
+
+  private:
+    struct Binding
+    {
+        std::optional<TaskId> id;
+        Task *task;
+        std::size_t revision;
+    };
+
+    device::TaskCollection &tasks;
+    std::array<Binding, numberOfKeys> bindings;
+    std::size_t revision = 0;
+
+    static std::optional<std::size_t> toIndex(KeyId key);
+    void resolve(Binding &binding);
+};
+
+namespace device
+{
+/**
+ * *The* assignment of task keys to tasks used by the device application.
+ */
+extern TaskKeyBindings taskKeyBindings;
+} // namespace device
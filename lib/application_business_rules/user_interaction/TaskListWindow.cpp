@@ -0,0 +1,80 @@
+#include "TaskListWindow.hpp"
+#include <algorithm>
+
+static bool operator==(const TaskListWindow::Row &lhs, const TaskListWindow::Row &rhs)
+{
+    return (lhs.id == rhs.id) && (lhs.label == rhs.label) && (lhs.duration == rhs.duration) && (lhs.isRunning == rhs.isRunning);
+}
+
+static bool operator==(const TaskListWindow::Page &lhs, const TaskListWindow::Page &rhs)
+{
+    return (lhs.first == rhs.first) && (lhs.numberOfTasks == rhs.numberOfTasks) && (lhs.numberOfRows == rhs.numberOfRows) &&
+           std::equal(lhs.rows.begin(), lhs.rows.begin() + lhs.numberOfRows, rhs.rows.begin());
+}
+
+void TaskListWindow::setRequestNotification(const std::function<void(void)> notification)
+{
+    requestNotification = notification;
+}
+
+void TaskListWindow::request(const std::size_t first)
+{
+    requestedFirst.store(first, std::memory_order_release);
+    if (requestNotification)
+    {
+        requestNotification();
+    }
+}
+
+void TaskListWindow::close()
+{
+    requestedFirst.store(closed, std::memory_order_release);
+}
+
+std::optional<TaskListWindow::Page> TaskListWindow::takePage()
+{
+    std::optional<Page> latest;
+    while (auto page = pages.pop())
+    {
+        latest = page;
+    }
+    return latest;
+}
+
+void TaskListWindow::update(const device::TaskCollection &tasks)
+{
+    const std::size_t first = requestedFirst.load(std::memory_order_acquire);
+    if (first == closed)
+    {
+        // deliver the page again when the list is opened again
+        delivered.reset();
+        return;
+    }
+
+    Page page{};
+    page.numberOfTasks = tasks.size();
+    page.first = std::min(first, (tasks.size() > visibleRows) ? (tasks.size() - visibleRows) : 0);
+    page.numberOfRows = std::min(visibleRows, tasks.size() - page.first);
+    const auto now = Task::Clock::now();
+    auto element = tasks.begin() + page.first;
+    for (std::size_t row = 0; row < page.numberOfRows; ++row, ++element)
+    {
+        const auto &[id, task] = *element;
+        page.rows[row] = {
+            .id = id,
+            .label = task.getLabel(),
+            .duration = std::chrono::duration_cast<std::chrono::minutes>(task.getRecordedDuration(now)),
+            .isRunning = task.isRunning(),
+        };
+    }
+
+    if (delivered && (*delivered == page))
+    {
+        return;
+    }
+    // if the queue is full, the page is delivered by one of the next updates
+    if (pages.push(page))
+    {
+        delivered = page;
+    }
+}
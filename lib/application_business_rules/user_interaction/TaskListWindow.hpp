@@ -0,0 +1,103 @@
+/**
+ * \file .
+ */
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <spsc_queue.hpp>
+#include <tasks/Task.hpp>
+
+/**
+ * Part of the task list which is visible on the display.
+ *
+ * The display shows only a few rows at once, but there may be thousands of tasks.
+ * Therefore the GUI does not receive the whole list, but requests the rows starting at an index.
+ * The requested rows are read by \ref update() in the context which owns the tasks,
+ * by random access into the contiguous task collection.
+ * Hence a scroll step takes constant time and memory, independent of the number of tasks.
+ *
+ * The GUI and the owner of the tasks may run in different contexts:
+ * - request(), close() and takePage() must be called from the GUI context only
+ * - update() must be called cyclically from the context which owns the tasks
+ *
+ * The rows are passed as a copy through a lock-free queue.
+ */
+class TaskListWindow
+{
+  public:
+    /**
+     * Number of rows visible at once.
+     */
+    static constexpr std::size_t visibleRows = 5;
+
+    struct Row
+    {
+        TaskId id;
+        Task::String label;
+        std::chrono::minutes duration; ///< recorded duration, in the resolution which is shown
+        bool isRunning;
+    };
+
+    /**
+     * Rows of the visible part of the list.
+     */
+    struct Page
+    {
+        std::size_t first;         ///< index of the first row within all tasks
+        std::size_t numberOfTasks; ///< length of the whole list
+        std::size_t numberOfRows;  ///< valid rows; less than visibleRows at the end of the list
+        std::array<Row, visibleRows> rows;
+    };
+
+    /**
+     * Sets a function which is called whenever rows have been requested.
+     *
+     * Allows the owner of the tasks to call update() as soon as possible instead of polling.
+     * \param notification is called from the GUI context; must not block
+     */
+    void setRequestNotification(const std::function<void(void)> notification);
+
+    /**
+     * Requests the rows of the visible part of the list.
+     *
+     * The page is delivered again whenever its content changes, until the window is closed.
+     * \param first index of the first visible row; is limited to the end of the list by update()
+     */
+    void request(std::size_t first);
+
+    /**
+     * Stops delivering pages, as the list is not visible anymore.
+     */
+    void close();
+
+    /**
+     * \returns the latest page which has been delivered since the last call, if any
+     */
+    std::optional<Page> takePage();
+
+    /**
+     * Delivers the requested page, if it has not been delivered or its content has changed.
+     *
+     * Takes constant time in the number of tasks and does not allocate memory.
+     * \param tasks the tasks to show
+     */
+    void update(const device::TaskCollection &tasks);
+
+  private:
+    static constexpr std::size_t closed = std::numeric_limits<std::size_t>::max();
+
+    std::atomic<std::size_t> requestedFirst{closed};
+    std::function<void(void)> requestNotification;
+
+    SpscQueue<Page, 2> pages;
+
+    /**
+     * Last page which has been put into the queue; owned by the context of update().
+     */
+    std::optional<Page> delivered;
+};
@@ -3,6 +3,7 @@
 #include "KeyIds.hpp"
 #include <chrono>
 #include <functional>
+#include <ostream>
 
 namespace board
 {
@@ -19,4 +20,11 @@ void setup();
 
 void playTone(const unsigned int frequency, const std::chrono::milliseconds duration);
 
+/**
+ * Prints the resource usage of the board adapters, the processor load of the tasks and the throughput of the buses.
+ *
+ * \param output stream to print to
+ */
+void printDiagnostics(std::ostream &output);
+
 } // namespace board
@@ -1,7 +1,25 @@
+#include "input_device_interface/debouncedIsr.hpp"
 #include "sound_output_interface/sound_output.hpp"
+#include <gauge.hpp>
+#include <load_meter.hpp>
+#include <rate_meter.hpp>
 #include <user_interaction/board_interface.hpp>
+#include <user_interaction/keypad_factory_interface.hpp>
 
 void board::setup()
 {
     board::setup_sound();
 }
+
+void board::printDiagnostics(std::ostream &output)
+{
+    const auto statistics = debouncer::getStatistics();
+    output << "debouncers: " << statistics.numberOfDebouncers << std::endl
+           << "debounce task stack size: " << statistics.stackSize << std::endl
+           << "debounce task stack high water mark: " << statistics.stackHighWaterMark << std::endl
+           << "debounce task stack reclaimed: " << statistics.reclaimedStack << std::endl
+           << "dropped key events: " << board::getKeypad().getDroppedEvents() << std::endl;
+    LoadMeter::printAll(output);
+    RateMeter::printAll(output);
+    Gauge::printAll(output);
+}
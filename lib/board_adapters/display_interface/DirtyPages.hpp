@@ -0,0 +1,119 @@
+/**
+ * \file .
+ */
+#pragma once
+
+#include "page_layout.hpp"
+#include <algorithm>
+#include <array>
+#include <limits>
+
+/**
+ * Records which columns of which pages of a display have been changed since the last transfer.
+ *
+ * Used to transfer only the changed parts of the frame buffer to the display.
+ * Displays like the SSD1306 accept a window of columns and pages, which is filled with the transferred bytes.
+ */
+class DirtyPages
+{
+  public:
+    typedef page_layout::Coordinate Coordinate;
+
+    /**
+     * Maximum number of pages of a display.
+     */
+    static constexpr Coordinate maxPages = 8;
+
+    /**
+     * Rectangle of whole pages.
+     */
+    struct Window
+    {
+        Coordinate x1; ///< first column
+        Coordinate x2; ///< last column
+        Coordinate firstPage;
+        Coordinate lastPage;
+
+        constexpr unsigned int getNumberOfBytes() const
+        {
+            return (x2 - x1 + 1) * (lastPage - firstPage + 1);
+        }
+    };
+
+    /**
+     * Marks an area as changed.
+     *
+     * \param area changed pixels; the pages it touches are marked
+     */
+    void mark(const page_layout::Area &area)
+    {
+        const Coordinate lastPage = std::min<Coordinate>(area.getLastPage(), maxPages - 1);
+        for (Coordinate page = std::max<Coordinate>(area.getFirstPage(), 0); page <= lastPage; ++page)
+        {
+            Columns &columns = pages[page];
+            columns.first = std::min(columns.first, area.x1);
+            columns.last = std::max(columns.last, area.x2);
+        }
+    }
+
+    /**
+     * \returns true if nothing has been changed
+     */
+    bool isClean() const
+    {
+        return std::none_of(pages.begin(), pages.end(), [](const Columns &columns) { return columns.isDirty(); });
+    }
+
+    /**
+     * Provides the changed parts as windows.
+     *
+     * Adjacent changed pages are combined into one window which covers the columns of all of them.
+     * Thus the number of windows, and hence the addressing overhead, is small,
+     * while unchanged pages are never transferred.
+     *
+     * \param process is called with each window from top to bottom
+     */
+    template <class Function>
+    void forEachWindow(Function process) const
+    {
+        Coordinate page = 0;
+        while (page < maxPages)
+        {
+            if (!pages[page].isDirty())
+            {
+                ++page;
+                continue;
+            }
+            Window window{.x1 = pages[page].first, .x2 = pages[page].last, .firstPage = page, .lastPage = page};
+            for (++page; (page < maxPages) && pages[page].isDirty(); ++page)
+            {
+                window.x1 = std::min(window.x1, pages[page].first);
+                window.x2 = std::max(window.x2, pages[page].last);
+                window.lastPage = page;
+            }
+            process(window);
+        }
+    }
+
+    /**
+     * Marks everything as unchanged.
+     */
+    void clear()
+    {
+        pages.fill(Columns{});
+    }
+
+  private:
+    struct Columns
+    {
+        Coordinate first = std::numeric_limits<Coordinate>::max();
+        Coordinate last = std::numeric_limits<Coordinate>::min();
+
+        constexpr bool isDirty() const
+        {
+            return first <= last;
+        }
+    };
+
+    std::array<Columns, maxPages> pages{};
+};
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "DirtyPages.hpp"
+#include <cstdint>
+
+/**
+ * Display which receives the content of a frame buffer in page layout.
+ */
+class IDisplayPanel
+{
+  public:
+    virtual ~IDisplayPanel() = default;
+
+    /**
+     * Transfers the changed parts of a frame buffer to the display.
+     *
+     * Blocks until the transfer has finished.
+     *
+     * \param framebuffer content of the whole display in page layout
+     * \param changes windows to be transferred
+     */
+    virtual void transfer(const std::uint8_t *framebuffer, const DirtyPages &changes) = 0;
+};
@@ -0,0 +1,76 @@
+/**
+ * \file .
+ */
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/**
+ * Transfers data within a single thread of the C++ standard library.
+ *
+ * This is the host implementation of the transfer worker.
+ * It shows the same behavior as the implementation for the target, which uses an RTOS task instead of a thread.
+ *
+ * \see ::startTransferWorker()
+ */
+class ThreadedTransferWorker
+{
+  public:
+    /**
+     * \param transfer is called by the thread whenever the worker is triggered
+     */
+    explicit ThreadedTransferWorker(const std::function<void(void)> &transfer)
+        : transfer(transfer), worker(&ThreadedTransferWorker::run, this)
+    {
+    }
+
+    ~ThreadedTransferWorker()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            isStopping = true;
+        }
+        wakeUp.notify_one();
+        worker.join();
+    }
+
+    ThreadedTransferWorker(const ThreadedTransferWorker &) = delete;
+    ThreadedTransferWorker &operator=(const ThreadedTransferWorker &) = delete;
+
+    void trigger()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            isTriggered = true;
+        }
+        wakeUp.notify_one();
+    }
+
+  private:
+    const std::function<void(void)> transfer;
+    std::mutex mutex;
+    std::condition_variable wakeUp;
+    bool isTriggered = false;
+    bool isStopping = false;
+    std::thread worker;
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true)
+        {
+            wakeUp.wait(lock, [this]() { return isTriggered || isStopping; });
+            if (isStopping)
+            {
+                return;
+            }
+            isTriggered = false;
+            lock.unlock();
+            transfer();
+            lock.lock();
+        }
+    }
+};
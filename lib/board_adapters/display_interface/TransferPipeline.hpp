@@ -0,0 +1,128 @@
+/**
+ * \file .
+ */
+#pragma once
+
+#include "DirtyPages.hpp"
+#include "IDisplayPanel.hpp"
+#include "page_layout.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+/**
+ * Double buffer which lets the transfer to the display overlap with rendering.
+ *
+ * The renderer draws into the back buffer.
+ * When a frame is complete, it is submitted: it is copied into the front buffer, which is transferred in the background.
+ * Meanwhile the renderer continues in the back buffer.
+ *
+ * If a frame is submitted while the previous one is still transferred, nothing is copied.
+ * The changes are kept and submitted with the next frame; hence, the renderer never waits for the display.
+ *
+ * Threading:
+ * - rendering, mark() and submit() must be done by a single context, the renderer
+ * - transfer() must be done by a single other context, the transfer worker
+ */
+class TransferPipeline
+{
+  public:
+    typedef page_layout::Coordinate Coordinate;
+
+    /**
+     * \param panel receives the frames
+     * \param width number of columns of the display
+     * \param height number of rows of the display
+     */
+    TransferPipeline(IDisplayPanel &panel, const Coordinate width, const Coordinate height)
+        : panel(panel),
+          size(static_cast<std::size_t>(width) * height / page_layout::pageHeight),
+          backBuffer(std::make_unique<std::uint8_t[]>(size)),
+          frontBuffer(std::make_unique<std::uint8_t[]>(size))
+    {
+    }
+
+    TransferPipeline(const TransferPipeline &) = delete;
+    TransferPipeline &operator=(const TransferPipeline &) = delete;
+
+    /**
+     * \returns the buffer to render into, in page layout
+     */
+    std::uint8_t *getBackBuffer()
+    {
+        return backBuffer.get();
+    }
+
+    /**
+     * Marks a rendered area of the back buffer to be transferred.
+     *
+     * \param area changed pixels
+     */
+    void mark(const page_layout::Area &area)
+    {
+        pendingChanges.mark(area);
+    }
+
+    /**
+     * \returns true if rendered changes have not been submitted yet
+     */
+    bool hasPendingChanges() const
+    {
+        return !pendingChanges.isClean();
+    }
+
+    /**
+     * \returns true if a submitted frame has not been transferred completely
+     */
+    bool isTransferring() const
+    {
+        return isFrameInTransfer.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Hands over the rendered changes to the transfer.
+     *
+     * Does not block.
+     *
+     * \retval true if the transfer worker needs to call transfer()
+     * \retval false if there is nothing to transfer or if the previous frame is still transferred
+     */
+    bool submit()
+    {
+        if (pendingChanges.isClean() || isFrameInTransfer.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+        std::memcpy(frontBuffer.get(), backBuffer.get(), size);
+        transferredChanges = pendingChanges;
+        pendingChanges.clear();
+        isFrameInTransfer.store(true, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Transfers the submitted frame to the panel.
+     *
+     * Called by the transfer worker; blocks while the panel transfers.
+     */
+    void transfer()
+    {
+        if (!isFrameInTransfer.load(std::memory_order_acquire))
+        {
+            return;
+        }
+        panel.transfer(frontBuffer.get(), transferredChanges);
+        isFrameInTransfer.store(false, std::memory_order_release);
+    }
+
+  private:
+    IDisplayPanel &panel;
+    const std::size_t size;
+    const std::unique_ptr<std::uint8_t[]> backBuffer;
+    const std::unique_ptr<std::uint8_t[]> frontBuffer;
+    DirtyPages pendingChanges;
+    DirtyPages transferredChanges;
+    std::atomic<bool> isFrameInTransfer{false};
+};
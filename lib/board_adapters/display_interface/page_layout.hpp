@@ -0,0 +1,125 @@
+/**
+ * \file .
+ * \brief Pixel layout of monochrome displays organized in pages, like the SSD1306.
+ *
+ * A page is a row of 8 pixels height.
+ * Each byte holds one column of a page; the least significant bit is the top pixel.
+ * Hence, a rectangle which starts and ends at page boundaries is a sequence of whole bytes per page,
+ * which can be copied without converting single pixels.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace page_layout
+{
+typedef std::int16_t Coordinate;
+
+/**
+ * Height of a page in pixels.
+ */
+constexpr Coordinate pageHeight = 8;
+
+/**
+ * Rectangle with inclusive coordinates.
+ */
+struct Area
+{
+    Coordinate x1;
+    Coordinate y1;
+    Coordinate x2;
+    Coordinate y2;
+
+    constexpr Coordinate getWidth() const
+    {
+        return x2 - x1 + 1;
+    }
+
+    constexpr Coordinate getFirstPage() const
+    {
+        return y1 / pageHeight;
+    }
+
+    constexpr Coordinate getLastPage() const
+    {
+        return y2 / pageHeight;
+    }
+};
+
+/**
+ * Extends an area vertically to page boundaries.
+ *
+ * \param area is extended in place
+ */
+constexpr void roundToPages(Area &area)
+{
+    area.y1 = area.y1 - (area.y1 % pageHeight);
+    area.y2 = area.y2 - (area.y2 % pageHeight) + pageHeight - 1;
+}
+
+/**
+ * Sets a single pixel.
+ *
+ * \param pages buffer in page layout
+ * \param width number of columns of the buffer
+ * \param x column of the pixel
+ * \param y row of the pixel
+ * \param isOn new state of the pixel
+ */
+inline void setPixel(std::uint8_t *const pages, const Coordinate width, const Coordinate x, const Coordinate y, const bool isOn)
+{
+    std::uint8_t &column = pages[static_cast<std::size_t>(y / pageHeight) * width + x];
+    const std::uint8_t bit = 1U << (y % pageHeight);
+    if (isOn)
+    {
+        column |= bit;
+    }
+    else
+    {
+        column &= ~bit;
+    }
+}
+
+/**
+ * \param pages buffer in page layout
+ * \param width number of columns of the buffer
+ * \param x column of the pixel
+ * \param y row of the pixel
+ * \returns the state of the pixel
+ */
+inline bool getPixel(const std::uint8_t *const pages, const Coordinate width, const Coordinate x, const Coordinate y)
+{
+    return pages[static_cast<std::size_t>(y / pageHeight) * width + x] & (1U << (y % pageHeight));
+}
+
+/**
+ * Copies a rendered area into the frame buffer of the display.
+ *
+ * Copies whole pages, no pixels are converted.
+ * An area of the full width is copied at once.
+ *
+ * \param framebuffer frame buffer of the display in page layout
+ * \param framebufferWidth number of columns of the display
+ * \param area destination in the frame buffer; must be rounded to pages
+ * \param pages rendered area in page layout; its width is the width of the area
+ */
+inline void copyPages(std::uint8_t *const framebuffer, const Coordinate framebufferWidth, const Area &area, const std::uint8_t *const pages)
+{
+    const std::size_t width = area.getWidth();
+    std::uint8_t *destination = framebuffer + static_cast<std::size_t>(area.getFirstPage()) * framebufferWidth + area.x1;
+    if (width == static_cast<std::size_t>(framebufferWidth))
+    {
+        std::memcpy(destination, pages, width * (area.getLastPage() - area.getFirstPage() + 1));
+        return;
+    }
+    const std::uint8_t *source = pages;
+    for (Coordinate page = area.getFirstPage(); page <= area.getLastPage(); ++page)
+    {
+        std::memcpy(destination, source, width);
+        destination += framebufferWidth;
+        source += width;
+    }
+}
+} // namespace page_layout
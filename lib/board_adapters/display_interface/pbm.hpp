@@ -0,0 +1,44 @@
+/**
+ * \file .
+ * \brief Export of frame buffers as portable bitmaps.
+ */
+#pragma once
+
+#include "page_layout.hpp"
+#include <cstdint>
+#include <ostream>
+
+/**
+ * Writes a frame buffer as binary portable bitmap (PBM, "P4").
+ *
+ * Pixels which are on are written black, like ink on paper.
+ * The image can be viewed with most image viewers and compared with other tools.
+ *
+ * \param output stream to write to; must be opened in binary mode
+ * \param pages frame buffer in page layout
+ * \param width number of columns of the frame buffer
+ * \param height number of rows of the frame buffer
+ */
+inline void writePbm(std::ostream &output, const std::uint8_t *const pages, const page_layout::Coordinate width, const page_layout::Coordinate height)
+{
+    output << "P4\n"
+           << width << " " << height << "\n";
+    for (page_layout::Coordinate y = 0; y < height; ++y)
+    {
+        // each row is packed into bytes, the leftmost pixel is the most significant bit
+        std::uint8_t packed = 0;
+        for (page_layout::Coordinate x = 0; x < width; ++x)
+        {
+            packed = (packed << 1) | (page_layout::getPixel(pages, width, x, y) ? 1 : 0);
+            if ((x % 8) == 7)
+            {
+                output.put(static_cast<char>(packed));
+                packed = 0;
+            }
+        }
+        if ((width % 8) != 0)
+        {
+            output.put(static_cast<char>(packed << (8 - width % 8)));
+        }
+    }
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <functional>
+
+/**
+ * Starts a context which transfers data to a display in the background.
+ *
+ * The transfer is done whenever the worker is triggered.
+ * Triggers during a transfer are coalesced into one further transfer.
+ *
+ * \param transfer is called by the worker; may block until the transfer has finished
+ * \returns a function which triggers the worker; it must not be called from interrupts
+ */
+std::function<void(void)> startTransferWorker(std::function<void(void)> transfer);
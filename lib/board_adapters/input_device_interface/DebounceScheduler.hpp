@@ -0,0 +1,141 @@
+/**
+ * \file .
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+
+/**
+ * Debounces several signals within a single context.
+ *
+ * Each signal is debounced by a channel which acts as a non-memorizing startup delay:
+ * The handler of the channel is called when the debounce time expires without a further signal.
+ * Every signal restarts the debounce time.
+ * The handler gets the point in time of the first signal of the burst,
+ * which is the point in time the signal has actually changed.
+ *
+ * Signalling a channel only sets a flag, so it may be done from an interrupt.
+ * The deadlines are evaluated by \ref process(), which must be called by a single context
+ * whenever a channel has been signalled and when the returned timeout expires.
+ * The handlers are called within that context.
+ *
+ * This contains no platform specific code; the platform provides the context and the waiting.
+ *
+ * \tparam Clock used for the deadlines; meets the requirements of *Clock* (see `std::chrono::steady_clock`)
+ * \tparam MaxChannels maximum number of channels
+ */
+template <class Clock, std::size_t MaxChannels>
+class DebounceScheduler
+{
+  public:
+    typedef std::size_t ChannelId;
+    typedef typename Clock::duration Duration;
+    typedef typename Clock::time_point TimePoint;
+
+    /**
+     * Called with the point in time of the first signal when the debounce time has expired.
+     */
+    typedef std::function<void(TimePoint)> Handler;
+
+    /**
+     * Adds a channel.
+     *
+     * Must not be called concurrently to itself.
+     * \param handler is called when the debounce time has expired
+     * \param debounceTime is the time which must pass without signal
+     * \throws std::length_error if no more channels are available
+     * \returns the ID to be used to signal the channel
+     */
+    ChannelId addChannel(const Handler &handler, const Duration debounceTime)
+    {
+        const ChannelId id = numberOfChannels.load(std::memory_order_relaxed);
+        if (id >= MaxChannels)
+        {
+            throw std::length_error("no more debounce channels available");
+        }
+        channels[id].handler = handler;
+        channels[id].debounceTime = debounceTime;
+        numberOfChannels.store(id + 1, std::memory_order_release);
+        return id;
+    }
+
+    /**
+     * Starts or restarts the debounce time of a channel.
+     *
+     * May be called from any context, including interrupts.
+     * \param id of the channel
+     * \param at point in time of the signal; only kept if it is the first signal of a burst
+     */
+    void signal(const ChannelId id, const TimePoint at) noexcept
+    {
+        Channel &channel = channels[id];
+        typename Duration::rep expected = noSignal;
+        channel.firstSignal.compare_exchange_strong(expected, at.time_since_epoch().count(), std::memory_order_relaxed);
+        channel.isSignalled.store(true, std::memory_order_release);
+    }
+
+    /**
+     * Takes over the signals and calls the handlers of all channels whose debounce time has expired.
+     *
+     * Linear in the number of channels.
+     * \param now current point in time
+     * \returns the time until the next debounce time expires or nothing if no channel is pending
+     */
+    std::optional<Duration> process(const TimePoint now)
+    {
+        std::optional<Duration> timeout;
+        const std::size_t count = numberOfChannels.load(std::memory_order_acquire);
+        for (std::size_t id = 0; id < count; ++id)
+        {
+            Channel &channel = channels[id];
+            if (channel.isSignalled.exchange(false, std::memory_order_acq_rel))
+            {
+                channel.deadline = now + channel.debounceTime;
+            }
+            if (channel.deadline && *channel.deadline <= now)
+            {
+                const TimePoint expired = *channel.deadline;
+                channel.deadline.reset();
+                const auto firstSignal = channel.firstSignal.exchange(noSignal, std::memory_order_relaxed);
+                // a burst which started while the previous one was completed has lost its first signal
+                channel.handler(firstSignal == noSignal ? expired - channel.debounceTime : TimePoint(Duration(firstSignal)));
+            }
+            if (channel.deadline)
+            {
+                const Duration remaining = *channel.deadline - now;
+                timeout = timeout ? std::min(*timeout, remaining) : remaining;
+            }
+        }
+        return timeout;
+    }
+
+    /**
+     * \returns number of channels
+     */
+    std::size_t size() const
+    {
+        return numberOfChannels.load(std::memory_order_acquire);
+    }
+
+  private:
+    static constexpr typename Duration::rep noSignal = std::numeric_limits<typename Duration::rep>::min();
+
+    struct Channel
+    {
+        Handler handler;
+        Duration debounceTime{};
+        std::optional<TimePoint> deadline;
+        std::atomic<bool> isSignalled{false};
+        std::atomic<typename Duration::rep> firstSignal{noSignal};
+    };
+
+    std::array<Channel, MaxChannels> channels;
+    std::atomic<std::size_t> numberOfChannels{0};
+};
@@ -1,15 +1,19 @@
 #include "Keypad.hpp"
 #include "debouncedIsr.hpp"
+#include "key_pins.hpp"
 #include <Arduino-wrapper.h>
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <board_pins.hpp>
 #include <cassert>
 #include <chrono>
 #include <cstddef>
 #include <functional>
 #include <iterator>
-#include <optional>
+#include <mpsc_queue.hpp>
+#include <type_traits.hpp>
+#include <user_interaction/KeyEvent.hpp>
 #include <utility>
 
 #if __has_include(<FunctionalInterrupt.h>) // specific to Arduino-ESP32
@@ -21,6 +25,7 @@ extern void attachInterrupt(uint8_t pin, std::function<void(void)> intRoutine, i
 using namespace std::chrono_literals;
 
 static HmiHandler callBack;
+static std::function<void(void)> eventNotification;
 
 /**
  * Debounce period.
@@ -30,56 +35,69 @@ static HmiHandler callBack;
 static constexpr auto debouncePeriod = 20ms;
 
 /**
- * Maps HMI buttons to events.
+ * Number of elements needed to use the ID of a key as index.
  */
-static constexpr std::pair<board::PinType, KeyId> selectionForPins[] = {
-    {board::button::pin::task1, KeyId::TASK1},
-    {board::button::pin::task2, KeyId::TASK2},
-    {board::button::pin::task3, KeyId::TASK3},
-    {board::button::pin::task4, KeyId::TASK4},
-    {board::button::pin::left, KeyId::LEFT},
-    {board::button::pin::right, KeyId::RIGHT},
-    {board::button::pin::enter, KeyId::ENTER},
-    {board::button::pin::back, KeyId::BACK},
-};
-
-static std::array<bool, std::size(selectionForPins)> keyPressedState;
-
-static std::optional<std::size_t> getStateIndex(const KeyId keyId)
-{
-    for (std::size_t index = 0; index < std::size(selectionForPins); ++index)
-    {
-        if (selectionForPins[index].second == keyId)
-        {
-            return index;
-        }
-    }
-    return std::nullopt;
-}
+static constexpr std::size_t numberOfKeyIds = to_underlying(KeyId::TASK4) + 1;
+
+/**
+ * Debounced states of the keys; the index is the ID of the key.
+ */
+static std::array<std::atomic<bool>, numberOfKeyIds> keyPressedState;
+
+/**
+ * Number of events which can be queued for all keys.
+ *
+ * Due to debouncing a key changes its state at most every \ref debouncePeriod.
+ */
+static constexpr std::size_t eventQueueSize = 16;
+
+/**
+ * Events of all keys in the order in which they have been debounced.
+ *
+ * The debouncers of all keys are producers, \ref Keypad::processEvents() is the single consumer.
+ * As all keys are debounced for the same period, this is the order in which the keys have changed.
+ */
+static MpscQueue<KeyEvent, eventQueueSize> keyEvents;
 
 /**
  * Reacts on a debounced (stabilized) pin change.
  *
- * It will be checked if the pin has "active" state.
- * If the pin is active, the callback handler will be called.
+ * The state of the pin is recorded and an event is queued if the state has changed.
+ * A bouncing pin may settle at its previous state, which is no key event.
+ * Returns immediately; the event is handled by \ref Keypad::processEvents().
  *
  * @param pin must be the I/O pin which has changed
- * @param keyId is an argument which will be passed to the callback handler
+ * @param keyId is the key connected to the pin
+ * @param timestamp is the point in time when the pin has started to change
  */
-static void reactOnPinChange(const board::PinType pin, KeyId keyId)
+static void reactOnPinChange(const board::PinType pin, KeyId keyId, const KeyEvent::Clock::time_point timestamp)
 {
     const bool isPressed = digitalRead(pin) == LOW;
-    if (isPressed)
+    const std::size_t index = to_underlying(keyId);
+    if (isPressed == keyPressedState[index])
+    {
+        return;
+    }
+    keyPressedState[index] = isPressed;
+    keyEvents.push({.id = keyId, .isPressed = isPressed, .timestamp = timestamp});
+    if (eventNotification)
     {
-        callBack(keyId);
+        eventNotification();
     }
-    keyPressedState.at(getStateIndex(keyId).value()) = isPressed;
 }
 
 Keypad::Keypad()
 {
+    for (auto &state : keyPressedState)
+    {
+        state = false;
+    }
+    // events of a previous keypad do not match the states anymore
+    while (keyEvents.pop())
+    {
+    }
+
     // input pins
-    std::size_t index = 0;
     for (const auto selectionForPin : selectionForPins)
     {
         pinMode(selectionForPin.first, INPUT_PULLUP);
@@ -88,20 +106,40 @@ Keypad::Keypad()
             createDebouncer(std::bind(
                                 reactOnPinChange,
                                 selectionForPin.first,
-                                selectionForPin.second),
+                                selectionForPin.second,
+                                std::placeholders::_1),
                             debouncePeriod),
             CHANGE);
-        index++;
     }
-    std::fill(std::begin(keyPressedState), std::end(keyPressedState), false);
 }
 
-void Keypad::setCallback(std::function<void(KeyId)> callbackFunction)
+void Keypad::setCallback(const HmiHandler callbackFunction)
 {
     callBack = callbackFunction;
 }
 
+void Keypad::setEventNotification(const std::function<void(void)> notification)
+{
+    eventNotification = notification;
+}
+
 bool Keypad::isKeyPressed(const KeyId keyInquiry)
 {
-    return keyPressedState.at(getStateIndex(keyInquiry).value());
+    return keyPressedState.at(to_underlying(keyInquiry));
+}
+
+void Keypad::processEvents()
+{
+    while (const auto event = keyEvents.pop())
+    {
+        if (callBack)
+        {
+            callBack(*event);
+        }
+    }
+}
+
+std::size_t Keypad::getDroppedEvents() const
+{
+    return keyEvents.getDroppedCount();
 }
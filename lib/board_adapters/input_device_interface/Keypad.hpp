@@ -7,5 +7,8 @@ class Keypad : public IKeypad
   public:
     Keypad();
     virtual void setCallback(const HmiHandler callbackFunction) override;
+    virtual void setEventNotification(const std::function<void(void)> notification) override;
     virtual bool isKeyPressed(KeyId keyInquiry) override;
+    virtual void processEvents() override;
+    virtual std::size_t getDroppedEvents() const override;
 };
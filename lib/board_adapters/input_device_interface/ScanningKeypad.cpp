@@ -0,0 +1,114 @@
+#include "ScanningKeypad.hpp"
+#include "key_pins.hpp"
+#include "periodicScan.hpp"
+#include <Arduino-wrapper.h>
+#include <type_traits.hpp>
+
+#if __has_include(<soc/gpio_reg.h>) // specific to ESP32
+#include <soc/gpio_reg.h>
+#include <soc/soc.h>
+#endif
+
+static_assert(to_underlying(KeyId::TASK4) < sizeof(VerticalCounter::Bits) * 8, "each key needs a bit");
+
+/**
+ * Reads the raw states of all keys.
+ *
+ * \returns a bit mask with the bits of the pressed keys set
+ */
+static VerticalCounter::Bits readPressedKeys()
+{
+#if __has_include(<soc/gpio_reg.h>)
+    // all buttons are connected to GPIO 0 to 31, thus a single register contains all of them
+    static_assert([]() {
+        for (const auto &selectionForPin : selectionForPins)
+        {
+            if (selectionForPin.first >= 32)
+            {
+                return false;
+            }
+        }
+        return true;
+    }());
+    const std::uint32_t levels = REG_READ(GPIO_IN_REG);
+    const auto isLow = [levels](const board::PinType pin) { return (levels & (1UL << pin)) == 0; };
+#else // we assume we build for unit tests
+    const auto isLow = [](const board::PinType pin) { return digitalRead(pin) == LOW; };
+#endif
+    VerticalCounter::Bits pressed = 0;
+    for (const auto &[pin, keyId] : selectionForPins)
+    {
+        if (isLow(pin))
+        {
+            pressed |= VerticalCounter::Bits(1) << to_underlying(keyId);
+        }
+    }
+    return pressed;
+}
+
+ScanningKeypad::ScanningKeypad()
+{
+    for (const auto &selectionForPin : selectionForPins)
+    {
+        pinMode(selectionForPin.first, INPUT_PULLUP);
+    }
+    startPeriodicScan(std::bind(&ScanningKeypad::scan, this), scanPeriod);
+}
+
+void ScanningKeypad::setCallback(const HmiHandler callbackFunction)
+{
+    callBack = callbackFunction;
+}
+
+void ScanningKeypad::setEventNotification(const std::function<void(void)> notification)
+{
+    eventNotification = notification;
+}
+
+bool ScanningKeypad::isKeyPressed(const KeyId keyInquiry)
+{
+    return (pressedKeys.load(std::memory_order_relaxed) >> to_underlying(keyInquiry)) & 1U;
+}
+
+void ScanningKeypad::scan()
+{
+    const VerticalCounter::Bits toggled = debouncer.sample(readPressedKeys());
+    if (toggled == 0)
+    {
+        return;
+    }
+    const VerticalCounter::Bits state = debouncer.getState();
+    pressedKeys.store(state, std::memory_order_relaxed);
+
+    // the change has started with the first of the stable samples
+    const auto timestamp = KeyEvent::Clock::now() - (VerticalCounter::samplesToChange - 1) * scanPeriod;
+    for (const auto &selectionForPin : selectionForPins)
+    {
+        const KeyId keyId = selectionForPin.second;
+        const VerticalCounter::Bits mask = VerticalCounter::Bits(1) << to_underlying(keyId);
+        if (toggled & mask)
+        {
+            keyEvents.push({.id = keyId, .isPressed = (state & mask) != 0, .timestamp = timestamp});
+        }
+    }
+    if (eventNotification)
+    {
+        eventNotification();
+    }
+}
+
+void ScanningKeypad::processEvents()
+{
+    while (const auto event = keyEvents.pop())
+    {
+        if (callBack)
+        {
+            callBack(*event);
+        }
+    }
+}
+
+std::size_t ScanningKeypad::getDroppedEvents() const
+{
+    return keyEvents.getDroppedCount();
+}
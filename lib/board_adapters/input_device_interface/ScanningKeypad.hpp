@@ -0,0 +1,62 @@
+#pragma once
+
+#include "VerticalCounter.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <spsc_queue.hpp>
+#include <user_interaction/IKeypad.hpp>
+#include <user_interaction/KeyEvent.hpp>
+
+/**
+ * Keypad which periodically scans all keys at once.
+ *
+ * In contrast to \ref Keypad no interrupts are needed.
+ * All pins are read by a single access to the input register of the GPIOs.
+ * All keys are debounced in parallel by a \ref VerticalCounter.
+ * The debounced states are kept in a single bit mask, so reading the state of a key is cheap.
+ *
+ * Select it by defining `KEYPAD_SCANNING` at build time.
+ */
+class ScanningKeypad : public IKeypad
+{
+  public:
+    /**
+     * Time between two scans.
+     *
+     * A key must be stable for \ref VerticalCounter::samplesToChange scans to change its state.
+     */
+    static constexpr std::chrono::milliseconds scanPeriod{5};
+
+    ScanningKeypad();
+    virtual void setCallback(const HmiHandler callbackFunction) override;
+    virtual void setEventNotification(const std::function<void(void)> notification) override;
+    virtual bool isKeyPressed(KeyId keyInquiry) override;
+    virtual void processEvents() override;
+    virtual std::size_t getDroppedEvents() const override;
+
+    /**
+     * Reads and debounces the states of all keys.
+     *
+     * Called periodically in the background; changes are queued as events.
+     */
+    void scan();
+
+  private:
+    HmiHandler callBack;
+    std::function<void(void)> eventNotification;
+    VerticalCounter debouncer;
+
+    /**
+     * Debounced states of the keys; the bit position is the ID of the key.
+     */
+    std::atomic<VerticalCounter::Bits> pressedKeys{0};
+
+    /**
+     * Events of all keys.
+     *
+     * Single producer (\ref scan()) and single consumer (\ref processEvents()).
+     */
+    SpscQueue<KeyEvent, 16> keyEvents;
+};
@@ -0,0 +1,101 @@
+/**
+ * \file .
+ */
+#pragma once
+
+#include "DebounceScheduler.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+/**
+ * Debounces signals within a single thread of the C++ standard library.
+ *
+ * This is the host implementation of the debounce service.
+ * It shows the same behavior as the implementation for the target, which uses an RTOS task instead of a thread.
+ *
+ * \tparam MaxChannels maximum number of debouncers
+ */
+template <std::size_t MaxChannels = 16>
+class ThreadedDebounceService
+{
+  public:
+    typedef std::chrono::steady_clock Clock;
+
+    ThreadedDebounceService() : worker(&ThreadedDebounceService::run, this)
+    {
+    }
+
+    ~ThreadedDebounceService()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            isStopping = true;
+        }
+        wakeUp.notify_one();
+        worker.join();
+    }
+
+    ThreadedDebounceService(const ThreadedDebounceService &) = delete;
+    ThreadedDebounceService &operator=(const ThreadedDebounceService &) = delete;
+
+    /**
+     * Creates a Debouncer.
+     *
+     * \see ::createDebouncer()
+     * \param handler is called by the thread of the service with the point in time of the first signal
+     * \param debounceTime is the time which shall be waited to recognize a stable signal
+     * \returns a function which must be called to register new signals
+     */
+    std::function<void(void)> createDebouncer(const std::function<void(Clock::time_point)> &handler, const std::chrono::milliseconds debounceTime)
+    {
+        const auto id = scheduler.addChannel(handler, debounceTime);
+        return [this, id]() {
+            scheduler.signal(id, Clock::now());
+            notify();
+        };
+    }
+
+  private:
+    DebounceScheduler<Clock, MaxChannels> scheduler;
+    std::mutex mutex;
+    std::condition_variable wakeUp;
+    bool isNotified = false;
+    bool isStopping = false;
+    std::thread worker;
+
+    void notify()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            isNotified = true;
+        }
+        wakeUp.notify_one();
+    }
+
+    void run()
+    {
+        std::optional<Clock::duration> timeout;
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!isStopping)
+        {
+            const auto isWokenUp = [this]() { return isNotified || isStopping; };
+            if (timeout)
+            {
+                wakeUp.wait_for(lock, *timeout, isWokenUp);
+            }
+            else
+            {
+                wakeUp.wait(lock, isWokenUp);
+            }
+            isNotified = false;
+            lock.unlock();
+            timeout = scheduler.process(Clock::now());
+            lock.lock();
+        }
+    }
+};
@@ -0,0 +1,60 @@
+/**
+ * \file .
+ */
+#pragma once
+
+#include <cstdint>
+
+/**
+ * Debounces up to 32 binary signals in parallel.
+ *
+ * Each signal has a 2 bit counter.
+ * The bits of the counters are stored "vertically" in two words, one word per bit of the counters.
+ * So all counters are updated at once with a few bitwise operations.
+ *
+ * A signal changes its debounced state when it has differed from it in 4 consecutive samples.
+ * Any sample which equals the debounced state restarts the counter of the signal.
+ */
+class VerticalCounter
+{
+  public:
+    /**
+     * One bit per signal.
+     */
+    typedef std::uint32_t Bits;
+
+    /**
+     * Number of consecutive samples which are necessary to change the debounced state.
+     */
+    static constexpr unsigned int samplesToChange = 4;
+
+    /**
+     * Takes a sample of all signals.
+     *
+     * \param sample current raw states of the signals
+     * \returns signals which have changed their debounced state with this sample
+     */
+    constexpr Bits sample(const Bits sample)
+    {
+        const Bits isDifferent = sample ^ state;
+        // count down while different, reset to 3 while equal
+        counterBit0 = ~(counterBit0 & isDifferent);
+        counterBit1 = counterBit0 ^ (counterBit1 & isDifferent);
+        const Bits toggled = isDifferent & counterBit0 & counterBit1;
+        state ^= toggled;
+        return toggled;
+    }
+
+    /**
+     * \returns the debounced states of the signals
+     */
+    constexpr Bits getState() const
+    {
+        return state;
+    }
+
+  private:
+    Bits state = 0;
+    Bits counterBit0 = ~Bits(0);
+    Bits counterBit1 = ~Bits(0);
+};
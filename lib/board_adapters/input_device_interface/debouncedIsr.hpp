@@ -1,10 +1,24 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <functional>
 
 namespace debouncer
 {
+/**
+ * Clock of the points in time passed to the handlers.
+ */
+typedef std::chrono::steady_clock Clock;
+
+/**
+ * Function called when a signal has been debounced.
+ *
+ * Gets the point in time of the first signal of the burst.
+ * This is the point in time the signal has actually changed; it is not delayed by the debounce time.
+ */
+typedef std::function<void(Clock::time_point)> Handler;
+
 /**
  * \defgroup debouncer_priority Debouncer task priority
  * @{
@@ -24,6 +38,37 @@ int maxPriorityToInt();
  */
 int defaultPriorityToInt();
 /** @}*/
+
+/**
+ * Resource usage of the debouncers.
+ */
+struct Statistics
+{
+    /**
+     * number of debouncers created
+     */
+    std::size_t numberOfDebouncers;
+
+    /**
+     * stack size of the task which serves all debouncers
+     */
+    std::size_t stackSize;
+
+    /**
+     * minimum free stack of the task which serves all debouncers
+     */
+    std::size_t stackHighWaterMark;
+
+    /**
+     * stack saved compared to a separate task per debouncer
+     */
+    std::size_t reclaimedStack;
+};
+
+/**
+ * \returns the current resource usage of the debouncers
+ */
+Statistics getStatistics();
 } // namespace debouncer
 
 /**
@@ -35,16 +80,16 @@ int defaultPriorityToInt();
  * The Debouncer acts as a non-memorizing startup delay.
  * A signal will only trigger the handler in case the debounce time expires while no further signal is recorded.
  *
- * The Debouncer will use some kind of thread or task to wait for the debounce time.
+ * All Debouncers share a single thread or task, which waits for the debounce times and calls the handlers.
  *
  * For each signal a separate Debouncer needs to be created.
  *
  * \param handler is the function to be called by the Debouncer
  * \param debounceTime is the time which shall be waited by the Debouncer to recognize a stable signal
- * \param priority is the priority of the debounce task used for that debouncer
+ * \param priority is the minimum priority of the shared debounce task
  * \returns a function which must be called by the user to register new signals
  */
 std::function<void(void)> createDebouncer(
-    std::function<void(void)> handler,
+    debouncer::Handler handler,
     std::chrono::milliseconds debounceTime,
     int priority = debouncer::defaultPriorityToInt());
@@ -0,0 +1,23 @@
+/**
+ * \file .
+ * Assignment of the keys to the pins of the board.
+ */
+#pragma once
+
+#include <board_pins.hpp>
+#include <user_interaction/KeyIds.hpp>
+#include <utility>
+
+/**
+ * Maps HMI buttons to events.
+ */
+static constexpr std::pair<board::PinType, KeyId> selectionForPins[] = {
+    {board::button::pin::task1, KeyId::TASK1},
+    {board::button::pin::task2, KeyId::TASK2},
+    {board::button::pin::task3, KeyId::TASK3},
+    {board::button::pin::task4, KeyId::TASK4},
+    {board::button::pin::left, KeyId::LEFT},
+    {board::button::pin::right, KeyId::RIGHT},
+    {board::button::pin::enter, KeyId::ENTER},
+    {board::button::pin::back, KeyId::BACK},
+};
@@ -1,11 +1,16 @@
 #include "Keypad.hpp"
+#include "ScanningKeypad.hpp"
 #include <user_interaction/keypad_factory_interface.hpp>
 
 namespace board
 {
 IKeypad &getKeypad()
 {
+#if defined(KEYPAD_SCANNING)
+    static ScanningKeypad keypad;
+#else
     static Keypad keypad;
+#endif
     return keypad;
 }
 } // namespace board
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+
+/**
+ * Calls a function periodically in the background.
+ *
+ * Used to sample inputs which are not observed by interrupts.
+ * The function is called by a single context; it must not block.
+ *
+ * \param scan is the function to be called
+ * \param period is the time between two calls
+ */
+void startPeriodicScan(std::function<void(void)> scan, std::chrono::milliseconds period);
@@ -0,0 +1,59 @@
+#include "FileStorage.hpp"
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
+static IStorage::Bytes readFile(const std::string &path)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file)
+    {
+        return IStorage::Bytes();
+    }
+    IStorage::Bytes content(static_cast<std::size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(reinterpret_cast<char *>(content.data()), content.size());
+    content.resize(static_cast<std::size_t>(file.gcount()));
+    return content;
+}
+
+FileStorage::FileStorage(const std::string &directory)
+    : snapshotPath(directory + "/tasks.snapshot"), temporaryPath(directory + "/tasks.snapshot.tmp"),
+      journalPath(directory + "/tasks.journal")
+{
+}
+
+IStorage::Bytes FileStorage::readSnapshot()
+{
+    return readFile(snapshotPath);
+}
+
+bool FileStorage::writeSnapshot(const std::uint8_t *const data, const std::size_t size)
+{
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char *>(data), size);
+        file.flush();
+        if (!file)
+        {
+            return false; // keep the previous snapshot and journal
+        }
+    }
+    if (std::rename(temporaryPath.c_str(), snapshotPath.c_str()) != 0)
+    {
+        return false;
+    }
+    std::ofstream(journalPath, std::ios::binary | std::ios::trunc);
+    return true;
+}
+
+IStorage::Bytes FileStorage::readJournal()
+{
+    return readFile(journalPath);
+}
+
+void FileStorage::appendJournal(const std::uint8_t *const data, const std::size_t size)
+{
+    std::ofstream file(journalPath, std::ios::binary | std::ios::app);
+    file.write(reinterpret_cast<const char *>(data), size);
+}
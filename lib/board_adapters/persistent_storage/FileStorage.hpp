@@ -0,0 +1,28 @@
+#pragma once
+
+#include <storage/IStorage.hpp>
+#include <string>
+
+/**
+ * Storage using files of a file system.
+ *
+ * The snapshot and the journal are stored in two files in a directory.
+ * A new snapshot is written to a temporary file first, which then replaces the snapshot by renaming.
+ */
+class FileStorage : public IStorage
+{
+  public:
+    /**
+     * \param directory path to an existing directory where the files are stored
+     */
+    FileStorage(const std::string &directory);
+    virtual Bytes readSnapshot() override;
+    virtual bool writeSnapshot(const std::uint8_t *data, std::size_t size) override;
+    virtual Bytes readJournal() override;
+    virtual void appendJournal(const std::uint8_t *data, std::size_t size) override;
+
+  private:
+    const std::string snapshotPath;
+    const std::string temporaryPath;
+    const std::string journalPath;
+};
@@ -0,0 +1,20 @@
+#pragma once
+
+namespace task_tracker_systems
+{
+
+/**
+ * assignment of a task to a task key
+ */
+struct KeyBindingObject
+{
+    /**
+     * number of the task key; starting with 1
+     */
+    unsigned int key;
+    /**
+     * unique identifier of the assigned task
+     */
+    unsigned int id;
+};
+} // namespace task_tracker_systems
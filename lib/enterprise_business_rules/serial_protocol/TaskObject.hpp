@@ -1,6 +1,6 @@
 #pragma once
 #include <chrono>
-#include <string>
+#include <string_view>
 
 namespace task_tracker_systems
 {
@@ -16,8 +16,10 @@ struct TaskObject
     unsigned int id;
     /**
      * name or summary; ASCII only, no line breaks
+     *
+     * Refers to the label of the task; must not outlive it.
      */
-    std::string label;
+    std::string_view label;
     /**
      * duration in seconds
      */
@@ -0,0 +1,219 @@
+/**
+ * \file .
+ * \brief Associative container with contiguous storage.
+ */
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+/**
+ * Sorted associative container which stores its elements contiguously.
+ *
+ * Provides the subset of the `std::map` interface which is needed by this software.
+ * In contrast to `std::map` the elements are not stored in individually allocated tree nodes
+ * but in a single array which is ordered by key.
+ * That makes iteration a linear walk through memory and lookups a binary search on contiguous data.
+ * Inserting or erasing elements in the middle is linear in the number of elements behind them.
+ * Appending an element with a key greater than all others is amortized constant.
+ *
+ * \warning Unlike `std::map`, the key of an element must not be modified through an iterator.
+ *          Also any insertion or erasure invalidates all iterators, pointers and references to elements.
+ *          \ref revision() allows to detect such modifications.
+ *
+ * \tparam Key type of the keys; must be less-than comparable
+ * \tparam T type of the mapped values
+ */
+template <class Key, class T>
+class FlatMap
+{
+  public:
+    typedef Key key_type;
+    typedef T mapped_type;
+    typedef std::pair<Key, T> value_type;
+
+  private:
+    typedef std::vector<value_type> Storage;
+
+  public:
+    typedef typename Storage::size_type size_type;
+    typedef typename Storage::iterator iterator;
+    typedef typename Storage::const_iterator const_iterator;
+
+    iterator begin() noexcept
+    {
+        return std::begin(elements);
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return std::cbegin(elements);
+    }
+
+    iterator end() noexcept
+    {
+        return std::end(elements);
+    }
+
+    const_iterator end() const noexcept
+    {
+        return std::cend(elements);
+    }
+
+    size_type size() const noexcept
+    {
+        return elements.size();
+    }
+
+    bool empty() const noexcept
+    {
+        return elements.empty();
+    }
+
+    /**
+     * Reserves storage for the given number of elements.
+     *
+     * Avoids repeated reallocation if the number of elements is known in advance.
+     * \param capacity number of elements to reserve storage for
+     */
+    void reserve(const size_type capacity)
+    {
+        elements.reserve(capacity);
+        modified();
+    }
+
+    void clear() noexcept
+    {
+        elements.clear();
+        modified();
+    }
+
+    /**
+     * Identifies the current layout of the elements in memory.
+     *
+     * The revision changes whenever an operation may have invalidated iterators, pointers or references to elements.
+     * Thus pointers to elements may be cached as long as the revision is the same as when they were obtained.
+     *
+     * \returns an identifier which changes with every invalidating modification
+     */
+    std::size_t revision() const noexcept
+    {
+        return currentRevision;
+    }
+
+    /**
+     * Searches for an element.
+     *
+     * \param key of the element to search for
+     * \returns iterator to the element or `end()` if there is no element with that key
+     */
+    iterator find(const key_type &key)
+    {
+        const auto position = lowerBound(key);
+        return (position != end() && position->first == key) ? position : end();
+    }
+
+    /**
+     * \copydoc find()
+     */
+    const_iterator find(const key_type &key) const
+    {
+        return const_cast<FlatMap *>(this)->find(key);
+    }
+
+    /**
+     * Accesses a mapped value.
+     *
+     * \param key of the element to access
+     * \returns reference to the mapped value
+     * \throws std::out_of_range in case there is no element with that key
+     */
+    mapped_type &at(const key_type &key)
+    {
+        const auto position = find(key);
+        if (position == end())
+        {
+            throw std::out_of_range("FlatMap::at");
+        }
+        return position->second;
+    }
+
+    /**
+     * \copydoc at()
+     */
+    const mapped_type &at(const key_type &key) const
+    {
+        return const_cast<FlatMap *>(this)->at(key);
+    }
+
+    /**
+     * Inserts an element in-place if no element with that key exists.
+     *
+     * \param key of the element to insert
+     * \param args arguments to construct the mapped value with
+     * \returns a pair of an iterator to the element with that key and
+     *          whether the element has been inserted
+     */
+    template <class... Args>
+    std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args)
+    {
+        const auto position = lowerBound(key);
+        if (position != end() && position->first == key)
+        {
+            return {position, false};
+        }
+        const auto inserted = elements.emplace(position,
+                                               std::piecewise_construct,
+                                               std::forward_as_tuple(key),
+                                               std::forward_as_tuple(std::forward<Args>(args)...));
+        modified();
+        return {inserted, true};
+    }
+
+    /**
+     * \copydoc try_emplace()
+     */
+    template <class... Args>
+    std::pair<iterator, bool> emplace(const key_type &key, Args &&...args)
+    {
+        return try_emplace(key, std::forward<Args>(args)...);
+    }
+
+    /**
+     * Removes the element with the given key.
+     *
+     * \param key of the element to remove
+     * \returns number of removed elements (0 or 1)
+     */
+    size_type erase(const key_type &key)
+    {
+        const auto position = find(key);
+        if (position == end())
+        {
+            return 0;
+        }
+        elements.erase(position);
+        modified();
+        return 1;
+    }
+
+  private:
+    Storage elements;
+    std::size_t currentRevision = 0;
+
+    void modified() noexcept
+    {
+        ++currentRevision;
+    }
+
+    iterator lowerBound(const key_type &key)
+    {
+        return std::lower_bound(begin(), end(), key, [](const value_type &element, const key_type &k) {
+            return element.first < k;
+        });
+    }
+};
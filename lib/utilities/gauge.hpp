@@ -0,0 +1,65 @@
+/**
+ * \file .
+ * \brief Publication of measured values for diagnostics.
+ */
+#pragma once
+#include "registered.hpp"
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+
+/**
+ * Holds the latest and the maximum of a measured value.
+ *
+ * All gauges are \ref Registered "registered", so they can be printed together.
+ * Values may be set by any task and read by any other task.
+ */
+class Gauge : public Registered<Gauge>
+{
+  public:
+    /**
+     * \param name identifies the value in the printout; must outlive the gauge
+     * \param unit of the value; must outlive the gauge
+     */
+    Gauge(const char *const name, const char *const unit)
+        : name(name), unit(unit)
+    {
+    }
+
+    void set(const std::uint32_t value)
+    {
+        latest.store(value, std::memory_order_relaxed);
+        std::uint32_t previousMaximum = maximum.load(std::memory_order_relaxed);
+        while ((value > previousMaximum) && !maximum.compare_exchange_weak(previousMaximum, value, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    std::uint32_t getLatest() const
+    {
+        return latest.load(std::memory_order_relaxed);
+    }
+
+    std::uint32_t getMaximum() const
+    {
+        return maximum.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Prints the values in one line.
+     *
+     * \param output stream to print to
+     */
+    void print(std::ostream &output) const
+    {
+        output << name << ": " << getLatest() << " " << unit
+               << " (maximum " << getMaximum() << " " << unit << ")" << std::endl;
+    }
+
+  private:
+    const char *const name;
+    const char *const unit;
+
+    std::atomic<std::uint32_t> latest{0};
+    std::atomic<std::uint32_t> maximum{0};
+};
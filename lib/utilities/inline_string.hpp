@@ -0,0 +1,135 @@
+/**
+ * \file .
+ * \brief String with a fixed capacity stored inline.
+ */
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * String of UTF-8 encoded characters with a fixed capacity.
+ *
+ * The characters are stored within the object itself, thus it never allocates memory.
+ * Assigning a longer string truncates it to the capacity.
+ * Truncation is done at a boundary of UTF-8 code points, so no incomplete character remains.
+ * The characters are always null-terminated.
+ *
+ * \tparam Capacity maximum number of bytes (not code points) without the terminating null character
+ */
+template <std::size_t Capacity>
+class InlineString
+{
+  public:
+    typedef char value_type;
+    typedef std::size_t size_type;
+    typedef const char *const_iterator;
+
+    static_assert(Capacity <= std::numeric_limits<std::uint8_t>::max(), "length is stored in a single byte");
+
+    InlineString() noexcept = default;
+
+    InlineString(const std::string_view other) noexcept
+    {
+        assign(other);
+    }
+
+    /**
+     * Converts anything which is convertible to `std::string_view`, for example `std::string` or `const char*`.
+     */
+    template <class StringLike, class = std::enable_if_t<std::is_convertible_v<const StringLike &, std::string_view> &&
+                                                         !std::is_same_v<StringLike, InlineString>>>
+    InlineString(const StringLike &other) noexcept : InlineString(std::string_view(other))
+    {
+    }
+
+    /**
+     * Replaces the content.
+     *
+     * \param other new content; truncated to the capacity if necessary
+     */
+    void assign(const std::string_view other) noexcept
+    {
+        std::size_t size = std::min(other.size(), Capacity);
+        if (size < other.size())
+        {
+            // do not split a code point: step back to the first byte of the code point which does not fit anymore
+            while (size > 0 && (static_cast<unsigned char>(other[size]) & 0xC0) == 0x80)
+            {
+                --size;
+            }
+        }
+        std::copy_n(other.data(), size, characters.data());
+        characters[size] = '\0';
+        length = static_cast<std::uint8_t>(size);
+    }
+
+    static constexpr size_type capacity() noexcept
+    {
+        return Capacity;
+    }
+
+    size_type size() const noexcept
+    {
+        return length;
+    }
+
+    bool empty() const noexcept
+    {
+        return length == 0;
+    }
+
+    const char *data() const noexcept
+    {
+        return characters.data();
+    }
+
+    const char *c_str() const noexcept
+    {
+        return characters.data();
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return characters.data();
+    }
+
+    const_iterator end() const noexcept
+    {
+        return characters.data() + length;
+    }
+
+    std::string_view view() const noexcept
+    {
+        return std::string_view(characters.data(), length);
+    }
+
+    operator std::string_view() const noexcept
+    {
+        return view();
+    }
+
+    friend bool operator==(const InlineString &lhs, const std::string_view rhs) noexcept
+    {
+        return lhs.view() == rhs;
+    }
+
+    friend bool operator!=(const InlineString &lhs, const std::string_view rhs) noexcept
+    {
+        return lhs.view() != rhs;
+    }
+
+    friend std::ostream &operator<<(std::ostream &stream, const InlineString &string)
+    {
+        return stream << string.view();
+    }
+
+  private:
+    std::array<char, Capacity + 1> characters{};
+    std::uint8_t length = 0;
+};
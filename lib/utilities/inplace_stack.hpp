@@ -0,0 +1,127 @@
+/**
+ * \file .
+ * \brief Stack of polymorphic objects with a fixed capacity stored inline.
+ */
+#pragma once
+#include <array>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * Stack of objects implementing a common interface.
+ *
+ * Each level of the stack has a slot which is large enough for any of the implementations.
+ * Pushing constructs the object within the slot and popping destroys it,
+ * thus it never allocates memory and the memory needed is known at compile time.
+ *
+ * \tparam Interface common base class; must have a virtual destructor
+ * \tparam Capacity maximum number of objects
+ * \tparam Implementations all classes which may be pushed
+ */
+template <class Interface, std::size_t Capacity, class... Implementations>
+class InplaceStack
+{
+  public:
+    typedef std::size_t size_type;
+
+    static_assert(std::has_virtual_destructor_v<Interface>, "objects are destroyed by their interface");
+    static_assert((std::is_base_of_v<Interface, Implementations> && ...), "all implementations must implement the interface");
+
+    InplaceStack() noexcept = default;
+
+    ~InplaceStack()
+    {
+        clear();
+    }
+
+    InplaceStack(const InplaceStack &) = delete;
+    InplaceStack &operator=(const InplaceStack &) = delete;
+
+    /**
+     * Constructs an object on top of the stack.
+     *
+     * \tparam Implementation one of the implementations of the stack
+     * \param arguments for the constructor of the object
+     * \returns the object, or `nullptr` if the stack is full
+     */
+    template <class Implementation, class... Args>
+    Implementation *push(Args &&...arguments)
+    {
+        static_assert((std::is_same_v<Implementation, Implementations> || ...), "slots are only sized for the implementations of the stack");
+        if (full())
+        {
+            return nullptr;
+        }
+        Implementation *const object = new (&slots[length]) Implementation(std::forward<Args>(arguments)...);
+        objects[length] = object;
+        ++length;
+        return object;
+    }
+
+    /**
+     * Destroys the object on top of the stack.
+     *
+     * Must not be called if the stack is empty.
+     */
+    void pop() noexcept
+    {
+        --length;
+        objects[length]->~Interface();
+        objects[length] = nullptr;
+    }
+
+    /**
+     * Destroys all objects, starting at the top.
+     */
+    void clear() noexcept
+    {
+        while (!empty())
+        {
+            pop();
+        }
+    }
+
+    /**
+     * Must not be called if the stack is empty.
+     *
+     * \returns the object on top of the stack
+     */
+    Interface &top() const noexcept
+    {
+        return *objects[length - 1];
+    }
+
+    size_type size() const noexcept
+    {
+        return length;
+    }
+
+    bool empty() const noexcept
+    {
+        return length == 0;
+    }
+
+    bool full() const noexcept
+    {
+        return length == Capacity;
+    }
+
+    static constexpr size_type capacity() noexcept
+    {
+        return Capacity;
+    }
+
+  private:
+    typedef std::aligned_union_t<0, Implementations...> Slot;
+
+    std::array<Slot, Capacity> slots;
+
+    /**
+     * The interface of an object may be located at an offset within its slot.
+     */
+    std::array<Interface *, Capacity> objects{};
+
+    size_type length = 0;
+};
@@ -0,0 +1,119 @@
+/**
+ * \file .
+ * \brief Measurement of the processor load caused by a task.
+ */
+#pragma once
+#include "registered.hpp"
+#include <atomic>
+#include <chrono>
+#include <ostream>
+
+/**
+ * Measures which share of the time a task is busy.
+ *
+ * The task reports when it starts and stops waiting.
+ * The time in between is counted as busy.
+ * The load is evaluated per measurement window, so it reflects the recent behavior of the task.
+ *
+ * All meters are \ref Registered "registered", so they can be printed together.
+ * Reporting must be done by the measured task only; reading the load is possible from any task.
+ */
+class LoadMeter : public Registered<LoadMeter>
+{
+  public:
+    typedef std::chrono::steady_clock Clock;
+
+    /**
+     * Duration of the measurement window.
+     */
+    static constexpr Clock::duration window = std::chrono::seconds(1);
+
+    /**
+     * \param name identifies the measured task in the printout; must outlive the meter
+     * \param core processor core the task is pinned to; negative if the task may run on any core
+     */
+    explicit LoadMeter(const char *const name, const int core = -1)
+        : name(name), core(core)
+    {
+    }
+
+    /**
+     * Reports that the task starts to wait, ending a busy period.
+     *
+     * \param now current point in time
+     */
+    void startWaiting(const Clock::time_point now)
+    {
+        busyTime += now - lastChange;
+        lastChange = now;
+        evaluate(now);
+    }
+
+    /**
+     * Reports that the task stops waiting, starting a busy period.
+     *
+     * \param now current point in time
+     */
+    void stopWaiting(const Clock::time_point now)
+    {
+        waitingTime += now - lastChange;
+        lastChange = now;
+        evaluate(now);
+    }
+
+    /**
+     * \returns the share of time the task has been busy in the last complete measurement window, in percent
+     */
+    unsigned int getPercentage() const
+    {
+        return percentage.load(std::memory_order_relaxed);
+    }
+
+    const char *getName() const
+    {
+        return name;
+    }
+
+    int getCore() const
+    {
+        return core;
+    }
+
+    /**
+     * Prints the load in one line.
+     *
+     * \param output stream to print to
+     */
+    void print(std::ostream &output) const
+    {
+        output << "load of task " << name;
+        if (core >= 0)
+        {
+            output << " on core " << core;
+        }
+        output << ": " << getPercentage() << " %" << std::endl;
+    }
+
+  private:
+    void evaluate(const Clock::time_point now)
+    {
+        if (now - windowStart < window)
+        {
+            return;
+        }
+        const auto total = busyTime + waitingTime;
+        percentage.store(total.count() > 0 ? static_cast<unsigned int>(busyTime * 100 / total) : 0, std::memory_order_relaxed);
+        busyTime = Clock::duration::zero();
+        waitingTime = Clock::duration::zero();
+        windowStart = now;
+    }
+
+    const char *const name;
+    const int core;
+
+    Clock::time_point windowStart = Clock::now();
+    Clock::time_point lastChange = windowStart;
+    Clock::duration busyTime = Clock::duration::zero();
+    Clock::duration waitingTime = Clock::duration::zero();
+    std::atomic<unsigned int> percentage{0};
+};
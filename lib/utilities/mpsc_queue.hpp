@@ -0,0 +1,120 @@
+/**
+ * \file .
+ * \brief Lock-free queue for passing data from several producers to a single consumer.
+ */
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+/**
+ * Bounded multi-producer single-consumer queue.
+ *
+ * Pushing and popping never block and never allocate memory.
+ * Each element of the ring carries a sequence number which tells whether the element is free or filled.
+ * Producers reserve an element by a compare-and-swap on the write position; the consumer owns the read position.
+ * This is the bounded queue by Dmitry Vyukov, reduced to a single consumer.
+ *
+ * \tparam T type of the elements; must be copy assignable and default constructible
+ * \tparam Capacity maximum number of elements in the queue; must be a power of 2
+ */
+template <class T, std::size_t Capacity>
+class MpscQueue
+{
+  public:
+    MpscQueue()
+    {
+        for (std::size_t index = 0; index < Capacity; ++index)
+        {
+            cells[index].sequence.store(index, std::memory_order_relaxed);
+        }
+    }
+
+    MpscQueue(const MpscQueue &) = delete;
+    MpscQueue &operator=(const MpscQueue &) = delete;
+
+    /**
+     * Appends an element.
+     *
+     * May be called concurrently by any number of producers.
+     * \param value to be appended
+     * \returns false if the queue is full; the element is dropped and counted
+     */
+    bool push(const T &value)
+    {
+        std::size_t position = writePosition.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Cell &cell = cells[position % Capacity];
+            const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+            if (difference == 0)
+            {
+                if (writePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    cell.value = value;
+                    cell.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0)
+            {
+                droppedCount.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            else
+            {
+                position = writePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * Removes the oldest element.
+     *
+     * Must only be called by a single consumer at a time.
+     * \returns the element or nothing if the queue is empty
+     */
+    std::optional<T> pop()
+    {
+        Cell &cell = cells[readPosition % Capacity];
+        const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        if (sequence != readPosition + 1)
+        {
+            return std::nullopt;
+        }
+        const T value = cell.value;
+        cell.sequence.store(readPosition + Capacity, std::memory_order_release);
+        ++readPosition;
+        return value;
+    }
+
+    /**
+     * \returns number of elements which have been dropped because the queue was full
+     */
+    std::size_t getDroppedCount() const
+    {
+        return droppedCount.load(std::memory_order_relaxed);
+    }
+
+    static constexpr std::size_t capacity()
+    {
+        return Capacity;
+    }
+
+  private:
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "capacity must be a power of 2");
+
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence;
+        T value;
+    };
+
+    std::array<Cell, Capacity> cells;
+    std::atomic<std::size_t> writePosition{0};
+    std::size_t readPosition = 0;
+    std::atomic<std::size_t> droppedCount{0};
+};
@@ -0,0 +1,93 @@
+/**
+ * \file .
+ * \brief Measurement of the throughput of a data flow.
+ */
+#pragma once
+#include "registered.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+
+/**
+ * Counts quantities, like transferred bytes, and evaluates them per second.
+ *
+ * The rate is evaluated per measurement window.
+ * A window is closed by the first count after its end, so the counting task should also count zero while idle.
+ *
+ * All meters are \ref Registered "registered", so they can be printed together.
+ * Counting must be done by one task only; reading is possible from any task.
+ */
+class RateMeter : public Registered<RateMeter>
+{
+  public:
+    typedef std::chrono::steady_clock Clock;
+
+    /**
+     * Duration of the measurement window.
+     */
+    static constexpr Clock::duration window = std::chrono::seconds(1);
+
+    /**
+     * \param name identifies the measured flow in the printout; must outlive the meter
+     * \param unit of the counted quantity; must outlive the meter
+     */
+    RateMeter(const char *const name, const char *const unit)
+        : name(name), unit(unit)
+    {
+    }
+
+    /**
+     * \param quantity amount to be added
+     * \param now current point in time
+     */
+    void count(const std::uint32_t quantity, const Clock::time_point now)
+    {
+        total.store(total.load(std::memory_order_relaxed) + quantity, std::memory_order_relaxed);
+        const auto elapsed = now - windowStart;
+        if (elapsed >= window)
+        {
+            const auto elapsedMilliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+            rate.store(static_cast<std::uint32_t>(inWindow * 1'000 / elapsedMilliseconds), std::memory_order_relaxed);
+            inWindow = 0;
+            windowStart = now;
+        }
+        inWindow += quantity;
+    }
+
+    /**
+     * \returns the quantity per second in the last complete measurement window
+     */
+    std::uint32_t getRate() const
+    {
+        return rate.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * \returns the quantity counted since start
+     */
+    std::uint64_t getTotal() const
+    {
+        return total.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Prints the rate in one line.
+     *
+     * \param output stream to print to
+     */
+    void print(std::ostream &output) const
+    {
+        output << name << ": " << getRate() << " " << unit << "/s, "
+               << getTotal() << " " << unit << " in total" << std::endl;
+    }
+
+  private:
+    const char *const name;
+    const char *const unit;
+
+    Clock::time_point windowStart = Clock::now();
+    std::uint64_t inWindow = 0;
+    std::atomic<std::uint32_t> rate{0};
+    std::atomic<std::uint64_t> total{0};
+};
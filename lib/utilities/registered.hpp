@@ -0,0 +1,56 @@
+/**
+ * \file .
+ * \brief Registry of the objects of a class, for printing diagnostics of all of them.
+ */
+#pragma once
+#include <atomic>
+#include <ostream>
+
+/**
+ * Base class which registers each object in a list on construction, so all objects can be printed together.
+ *
+ * The list is intrusive, thus registering neither locks nor allocates memory.
+ * Objects must not be destroyed, as they cannot unregister; they are meant to be static or to be members of singletons.
+ *
+ * \tparam Derived the registered class; must provide `void print(std::ostream &output) const`, which prints one line
+ */
+template <class Derived>
+class Registered
+{
+  public:
+    Registered(const Registered &) = delete;
+    Registered &operator=(const Registered &) = delete;
+
+    /**
+     * Prints all objects, one line per object, the latest constructed first.
+     *
+     * \param output stream to print to
+     */
+    static void printAll(std::ostream &output)
+    {
+        for (const Registered *object = first.load(std::memory_order_acquire); object; object = object->next)
+        {
+            static_cast<const Derived *>(object)->print(output);
+        }
+    }
+
+  protected:
+    Registered()
+    {
+        // objects may be constructed concurrently, for example function-local statics of different tasks
+        next = first.load(std::memory_order_relaxed);
+        while (!first.compare_exchange_weak(next, this, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    ~Registered() = default;
+
+  private:
+    /**
+     * Set once on construction, before the object becomes reachable through \ref first.
+     */
+    const Registered *next;
+
+    static inline std::atomic<const Registered *> first{nullptr};
+};
@@ -0,0 +1,103 @@
+/**
+ * \file .
+ * \brief Lock-free queue for passing data from a single producer to a single consumer.
+ */
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <optional>
+
+/**
+ * Bounded single-producer single-consumer ring buffer.
+ *
+ * Pushing and popping never block and never allocate memory.
+ * The producer only writes the write position, the consumer only writes the read position.
+ * Thus no compare-and-swap is needed; loads and stores with acquire/release semantics suffice.
+ *
+ * \tparam T type of the elements; must be copy assignable and default constructible
+ * \tparam Capacity maximum number of elements in the queue; must be a power of 2
+ */
+template <class T, std::size_t Capacity>
+class SpscQueue
+{
+  public:
+    SpscQueue() = default;
+    SpscQueue(const SpscQueue &) = delete;
+    SpscQueue &operator=(const SpscQueue &) = delete;
+
+    /**
+     * Appends an element.
+     *
+     * Must only be called by a single producer at a time.
+     * \param value to be appended
+     * \returns false if the queue is full; the element is dropped and counted
+     */
+    bool push(const T &value)
+    {
+        const std::size_t position = writePosition.load(std::memory_order_relaxed);
+        if (position - readPosition.load(std::memory_order_acquire) == Capacity)
+        {
+            droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        elements[position % Capacity] = value;
+        writePosition.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Gets the oldest element without removing it.
+     *
+     * Must only be called by the consumer.
+     * \returns pointer to the element or `nullptr` if the queue is empty; valid until the element is popped
+     */
+    const T *peek() const
+    {
+        const std::size_t position = readPosition.load(std::memory_order_relaxed);
+        if (position == writePosition.load(std::memory_order_acquire))
+        {
+            return nullptr;
+        }
+        return &elements[position % Capacity];
+    }
+
+    /**
+     * Removes the oldest element.
+     *
+     * Must only be called by a single consumer at a time.
+     * \returns the element or nothing if the queue is empty
+     */
+    std::optional<T> pop()
+    {
+        const T *const element = peek();
+        if (!element)
+        {
+            return std::nullopt;
+        }
+        const T value = *element;
+        readPosition.store(readPosition.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        return value;
+    }
+
+    /**
+     * \returns number of elements which have been dropped because the queue was full
+     */
+    std::size_t getDroppedCount() const
+    {
+        return droppedCount.load(std::memory_order_relaxed);
+    }
+
+    static constexpr std::size_t capacity()
+    {
+        return Capacity;
+    }
+
+  private:
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "capacity must be a power of 2");
+
+    std::array<T, Capacity> elements{};
+    std::atomic<std::size_t> writePosition{0};
+    std::atomic<std::size_t> readPosition{0};
+    std::atomic<std::size_t> droppedCount{0};
+};
@@ -0,0 +1,85 @@
+/**
+ * \file .
+ * \brief Variable length encoding of unsigned integers.
+ *
+ * Uses the LEB128 format: 7 bits per byte, least significant group first.
+ * The most significant bit of each byte indicates that another byte follows.
+ * Small values need fewer bytes; values below 128 need a single byte.
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+/**
+ * Maximum number of bytes needed to encode a value of the given type.
+ *
+ * \tparam Unsigned unsigned integer type
+ */
+template <class Unsigned>
+constexpr std::size_t maxVarintSize = (std::numeric_limits<Unsigned>::digits + 6) / 7;
+
+/**
+ * Calculates the number of bytes needed to encode a value.
+ *
+ * \param value to be encoded
+ * \returns number of bytes
+ */
+template <class Unsigned>
+constexpr std::size_t getVarintSize(Unsigned value)
+{
+    static_assert(std::is_unsigned_v<Unsigned>);
+    std::size_t size = 1;
+    while (value >= 0x80)
+    {
+        value >>= 7;
+        ++size;
+    }
+    return size;
+}
+
+/**
+ * Encodes a value.
+ *
+ * \param value to be encoded
+ * \param destination must provide space for at least `getVarintSize(value)` bytes
+ * \returns pointer behind the last written byte
+ */
+template <class Unsigned>
+std::uint8_t *encodeVarint(Unsigned value, std::uint8_t *destination)
+{
+    static_assert(std::is_unsigned_v<Unsigned>);
+    while (value >= 0x80)
+    {
+        *destination++ = static_cast<std::uint8_t>(value | 0x80);
+        value >>= 7;
+    }
+    *destination++ = static_cast<std::uint8_t>(value);
+    return destination;
+}
+
+/**
+ * Decodes a value.
+ *
+ * \param begin points to the first byte of the encoded value
+ * \param end points behind the last byte which may be read
+ * \param[out] value the decoded value
+ * \returns pointer behind the last read byte or `nullptr` in case the encoding is truncated or too long for the type
+ */
+template <class Unsigned>
+const std::uint8_t *decodeVarint(const std::uint8_t *begin, const std::uint8_t *const end, Unsigned &value)
+{
+    static_assert(std::is_unsigned_v<Unsigned>);
+    value = 0;
+    for (unsigned int shift = 0; begin != end && shift < std::numeric_limits<Unsigned>::digits; shift += 7)
+    {
+        const std::uint8_t byte = *begin++;
+        value |= static_cast<Unsigned>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return begin;
+        }
+    }
+    return nullptr;
+}
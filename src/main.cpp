@@ -2,11 +2,14 @@
  * \file
  */
 
+#include <algorithm>
 #include <chrono>
+#include <scheduling/main_loop.hpp>
 #include <serial_interface/Protocol.hpp>
 #include <serial_interface/serial_port.hpp>
+#include <storage/TaskJournal.hpp>
+#include <storage/storage_factory_interface.hpp>
 #include <tasks/Task.hpp>
-#include <thread>
 #include <user_interaction/Menu.hpp>
 #include <user_interaction/Presenter.hpp>
 #include <user_interaction/ProcessHmiInputs.hpp>
@@ -14,8 +17,18 @@
 #include <user_interaction/keypad_factory_interface.hpp>
 #include <user_interaction/statusindicators_factory_interface.hpp>
 
+using namespace std::chrono_literals;
+
+/**
+ * Maximum time the main loop sleeps.
+ *
+ * Work which is due to elapsed time, like writing the journal, is done at least this often.
+ */
+static constexpr auto maximumSleepTime = 1'000ms;
+
 void setup()
 {
+    main_loop::initialize();
     serial_port::initialize();
     serial_port::cout << "\x1b[20h"; // Tell the terminal to use CR/LF for newlines instead of just CR.
     static constexpr const auto programIdentificationString = __FILE__ " compiled at " __DATE__ " " __TIME__;
@@ -24,19 +37,29 @@ void setup()
     serial_port::setCallbackForLineReception([](const serial_port::String &commandLine) {
         ProtocolHandler::execute(commandLine.c_str());
     });
+    serial_port::setCallbackForDataReception(main_loop::notify);
+    board::getKeypad().setEventNotification(main_loop::notify);
+
+    const auto beginOfRestore = std::chrono::steady_clock::now();
+    device::journal.attach(board::getStorage());
+    device::journal.restore(device::tasks);
+    const auto restoreDuration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - beginOfRestore);
+    serial_port::cout << " restored " << device::tasks.size() << " tasks in " << restoreDuration.count() << " ms" << std::endl;
 }
 
 void loop()
 {
-    static Menu singleMenu(board::getGuiEngine(), board::getKeypad());
+    static Menu singleMenu(board::getGuiEngine(), board::getKeypad(), main_loop::notify);
     static Presenter presenter(singleMenu, board::getStatusIndicators());
     static ProcessHmiInputs processHmiInputs(presenter, board::getKeypad());
 
     serial_port::readAndHandleInput();
+    board::getKeypad().processEvents();
+    const auto timeUntilGesture = processHmiInputs.loop();
 
-    std::this_thread::yield();
-    using namespace std::chrono_literals;
-    std::this_thread::sleep_for(100ms);
+    const auto timeUntilRefresh = presenter.loop();
+    device::journal.loop(device::tasks);
 
-    presenter.loop();
+    // sleep until new input arrives, a long press is due or the GUI needs to be refreshed
+    main_loop::waitForWork(std::min<std::chrono::milliseconds>({timeUntilGesture, timeUntilRefresh, maximumSleepTime}));
 }
@@ -0,0 +1,37 @@
+/**
+ * \file .
+ * Replaces the global `operator new` by one which counts the allocations.
+ *
+ * Allows to check that code does not allocate memory.
+ * Replacing the operator affects the whole program, thus this must be included by only one file of a test.
+ */
+#pragma once
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+/**
+ * Number of allocations so far; may be reset by the test.
+ */
+static std::size_t numberOfAllocations = 0;
+
+void *operator new(const std::size_t size)
+{
+    ++numberOfAllocations;
+    void *const memory = std::malloc(size ? size : 1);
+    if (!memory)
+    {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void operator delete(void *const memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void *const memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
@@ -0,0 +1,15 @@
+#pragma once
+#include <string>
+#include <tasks/Task.hpp>
+
+/**
+ * Adds tasks with ascending IDs, beginning at 0, and the label "Task <ID>".
+ */
+static void createTasks(device::TaskCollection &tasks, const TaskId numberOfTasks)
+{
+    tasks.reserve(numberOfTasks);
+    for (TaskId id = 0; id < numberOfTasks; ++id)
+    {
+        tasks.try_emplace(id, "Task " + std::to_string(id));
+    }
+}
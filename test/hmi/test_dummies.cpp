@@ -3,6 +3,7 @@
 #include <board_pins.hpp>
 #include <cassert>
 #include <input_device_interface/debouncedIsr.hpp>
+#include <input_device_interface/periodicScan.hpp>
 #include <iomanip>
 #include <iostream>
 #include <iterator>
@@ -25,14 +26,28 @@ int debouncer::defaultPriorityToInt()
     return 0xC0FFE;
 }
 
+// point in time of the interrupt which is triggered
+static debouncer::Clock::time_point interruptTimestamp;
+
 // test dummy for a FreeRTOS adapter function
-std::function<void(void)> createDebouncer(const std::function<void(void)> handler, std::chrono::milliseconds, int)
+std::function<void(void)> createDebouncer(const debouncer::Handler handler, std::chrono::milliseconds, int)
+{
+    return [handler]() { handler(interruptTimestamp); };
+}
+
+// test dummy for a FreeRTOS adapter function; the tests call the scan themselves
+void startPeriodicScan(std::function<void(void)>, std::chrono::milliseconds)
 {
-    return handler;
 }
 
 void changeButtonState(const board::PinType pin)
 {
+    changeButtonState(pin, std::chrono::steady_clock::now());
+}
+
+void changeButtonState(const board::PinType pin, const std::chrono::steady_clock::time_point timestamp)
+{
+    interruptTimestamp = timestamp;
     const auto isr = isr_collection.find(pin); // ISR we expect for that pin
     assert(isr != std::end(isr_collection));   // assert we found an ISR
     std::cout << "trigger ISR for pin " << static_cast<int>(pin) << std::endl;
@@ -1,5 +1,6 @@
 #pragma once
 #include <board_types.hpp>
+#include <chrono>
 #include <functional>
 #include <map>
 
@@ -9,3 +10,8 @@ extern std::map<board::PinType, std::function<void(void)>> isr_collection;
  * Triggers a interrupt and sets the internal state.
  */
 void changeButtonState(board::PinType pin);
+
+/**
+ * Triggers a interrupt which has occurred at a given point in time.
+ */
+void changeButtonState(board::PinType pin, std::chrono::steady_clock::time_point timestamp);
@@ -6,6 +6,7 @@
 #include <cstdint>
 #include <input_device_interface/debouncedIsr.hpp>
 #include <ios>
+#include <iostream>
 #include <iterator>
 #include <serial_interface/serial_port.hpp>
 #include <tasks/Task.hpp>
@@ -14,6 +15,7 @@
 #include <user_interaction/IKeypad.hpp>
 #include <user_interaction/IPresenter.hpp>
 #include <user_interaction/ProcessHmiInputs.hpp>
+#include <user_interaction/TaskKeyBindings.hpp>
 #include <user_interaction/keypad_factory_interface.hpp>
 
 using namespace std::chrono_literals;
@@ -35,13 +37,30 @@ std::basic_ostream<CharType> &cout = std::cout;
 
 void setUp()
 {
-    isr_collection.clear();
+    // the interrupts of the keypad are attached only once, as it is a singleton
 }
 
 void tearDown()
 {
 }
 
+/**
+ * Presses and releases a key.
+ */
+static void tapKey(const board::PinType pin, const std::chrono::steady_clock::time_point pressed, const std::chrono::steady_clock::time_point released)
+{
+    When(Method(ArduinoFake(), digitalRead).Using(pin)).AlwaysReturn(LOW);
+    changeButtonState(pin, pressed);
+    When(Method(ArduinoFake(), digitalRead).Using(pin)).AlwaysReturn(HIGH);
+    changeButtonState(pin, released);
+}
+
+static void tapKey(const board::PinType pin)
+{
+    const auto now = std::chrono::steady_clock::now();
+    tapKey(pin, now, now + 100ms);
+}
+
 void test_Controller()
 {
     // irrelevant test doubles
@@ -53,37 +72,170 @@ void test_Controller()
     ProcessHmiInputs processor(getFakePresenter(), board::getKeypad());
     auto &task1 = std::begin(device::tasks)->second; // we are going to test for task 1
 
-    When(Method(ArduinoFake(), digitalRead).Using(board::button::pin::task1)).Return(LOW); // set task 1 button to low
-    changeButtonState(board::button::pin::task1);
+    tapKey(board::button::pin::task1);
 
     // wait for the task to be running
     while (!task1.isRunning())
     {
         // TODO it would be better to explicitly check for the "stop" task to be finished
         std::this_thread::yield(); // give the task handler time to finish before the test interferes
+        board::getKeypad().processEvents();
+        processor.loop();
     }
     constexpr int millisecondsToWait = 1000;
     std::this_thread::sleep_for(std::chrono::milliseconds(millisecondsToWait)); // wait a defined time
 
-    When(Method(ArduinoFake(), digitalRead).Using(board::button::pin::task1)).Return(LOW); // set task 1 button to low
-    changeButtonState(board::button::pin::task1);                                          // stop task
+    tapKey(board::button::pin::task1); // stop task
 
     // wait for the task to be stopped
     while (task1.isRunning())
     {
         // TODO it would be better to explicitly check for the "start" task to be finished
         std::this_thread::yield(); // give the task handler time to finish before the test interferes
+        board::getKeypad().processEvents();
+        processor.loop();
     }
     // assert results
     const auto millisecondsMeasured = std::chrono::duration_cast<std::chrono::milliseconds>(task1.getRecordedDuration());
     TEST_ASSERT_INT_WITHIN(10, millisecondsToWait, millisecondsMeasured.count());
 }
 
+void test_key_press_latency()
+{
+    ProcessHmiInputs processor(getFakePresenter(), board::getKeypad());
+    auto &task2 = device::tasks.at(32);
+    const auto durationBefore = task2.getRecordedDuration();
+
+    // the key presses have happened long before they are processed
+    const auto pressed = std::chrono::steady_clock::now() - 10s;
+    const auto pressedAgain = pressed + 3s;
+    tapKey(board::button::pin::task2, pressed, pressed + 100ms);
+    board::getKeypad().processEvents();
+    processor.loop();
+    TEST_ASSERT_TRUE(task2.isRunning());
+    tapKey(board::button::pin::task2, pressedAgain, pressedAgain + 100ms);
+    board::getKeypad().processEvents();
+    processor.loop();
+    TEST_ASSERT_FALSE(task2.isRunning());
+
+    // the recorded duration does not depend on the processing delay
+    TEST_ASSERT_EQUAL_INT64(3, (task2.getRecordedDuration() - durationBefore).count());
+}
+
+void test_long_press_focuses_task()
+{
+    ProcessHmiInputs processor(getFakePresenter(), board::getKeypad());
+    auto &task2 = device::tasks.at(32);
+    auto &task3 = device::tasks.at(33);
+    auto &task4 = device::tasks.at(34);
+    const auto task2Before = task2.getRecordedDuration();
+    const auto task4Before = task4.getRecordedDuration();
+    const auto start = std::chrono::steady_clock::now() - 10s;
+
+    tapKey(board::button::pin::task2, start, start + 100ms);
+    tapKey(board::button::pin::task4, start + 1s, start + 1s + 100ms);
+    board::getKeypad().processEvents();
+    processor.loop();
+    TEST_ASSERT_TRUE(task2.isRunning());
+    TEST_ASSERT_TRUE(task4.isRunning());
+
+    // hold task 3
+    tapKey(board::button::pin::task3, start + 3s, start + 5s);
+    board::getKeypad().processEvents();
+    processor.loop();
+    TEST_ASSERT_TRUE(task3.isRunning());
+    TEST_ASSERT_FALSE(task2.isRunning());
+    TEST_ASSERT_FALSE(task4.isRunning());
+
+    // the other tasks have been stopped when the key has been pressed
+    TEST_ASSERT_EQUAL_INT64(3, (task2.getRecordedDuration() - task2Before).count());
+    TEST_ASSERT_EQUAL_INT64(2, (task4.getRecordedDuration() - task4Before).count());
+}
+
+void test_chord_toggles_each_task()
+{
+    ProcessHmiInputs processor(getFakePresenter(), board::getKeypad());
+    auto &task1 = device::tasks.at(31);
+    auto &task2 = device::tasks.at(32);
+    const bool wasRunning1 = task1.isRunning();
+    const bool wasRunning2 = task2.isRunning();
+    const auto pressed = std::chrono::steady_clock::now() - 1s;
+
+    // both keys are held at the same time
+    When(Method(ArduinoFake(), digitalRead).Using(board::button::pin::task1)).AlwaysReturn(LOW);
+    changeButtonState(board::button::pin::task1, pressed);
+    When(Method(ArduinoFake(), digitalRead).Using(board::button::pin::task2)).AlwaysReturn(LOW);
+    changeButtonState(board::button::pin::task2, pressed + 50ms);
+    When(Method(ArduinoFake(), digitalRead).Using(board::button::pin::task1)).AlwaysReturn(HIGH);
+    changeButtonState(board::button::pin::task1, pressed + 200ms);
+    When(Method(ArduinoFake(), digitalRead).Using(board::button::pin::task2)).AlwaysReturn(HIGH);
+    changeButtonState(board::button::pin::task2, pressed + 200ms);
+    board::getKeypad().processEvents();
+    processor.loop();
+
+    TEST_ASSERT_TRUE(task1.isRunning() != wasRunning1);
+    TEST_ASSERT_TRUE(task2.isRunning() != wasRunning2);
+}
+
+void test_long_press_stops_tasks_without_key()
+{
+    ProcessHmiInputs processor(getFakePresenter(), board::getKeypad());
+    auto &unboundTask = device::tasks.try_emplace(36, "started by a command").first->second;
+    const auto start = std::chrono::steady_clock::now() - 10s;
+    unboundTask.start(start);
+
+    // hold task 1
+    tapKey(board::button::pin::task1, start + 1s, start + 3s);
+    board::getKeypad().processEvents();
+    processor.loop();
+    TEST_ASSERT_TRUE(device::tasks.at(31).isRunning());
+    TEST_ASSERT_FALSE(device::tasks.at(36).isRunning());
+    TEST_ASSERT_EQUAL_INT64(1, device::tasks.at(36).getRecordedDuration().count());
+}
+
+/**
+ * Counts the changes of the status indicators, each of which is signalled by a tone.
+ */
+class CountingPresenter : public IPresenter
+{
+  public:
+    void setTaskStatusIndicator(const TaskIndex, const TaskIndicatorState) override
+    {
+        ++numberOfChanges;
+    }
+
+    unsigned int numberOfChanges = 0;
+};
+
+void test_indicators_are_set_on_changes_only()
+{
+    CountingPresenter presenter;
+    ProcessHmiInputs processor(presenter, board::getKeypad());
+    TEST_ASSERT_EQUAL_UINT(1, presenter.numberOfChanges); // task 1 is still running
+
+    // neither binding a key again nor adding a task changes what is shown
+    device::taskKeyBindings.bind(KeyId::TASK1, 31);
+    device::tasks.try_emplace(35, "Task 5");
+    processor.loop();
+    TEST_ASSERT_EQUAL_UINT(1, presenter.numberOfChanges);
+
+    const auto pressed = std::chrono::steady_clock::now() - 1s;
+    tapKey(board::button::pin::task1, pressed, pressed + 100ms);
+    board::getKeypad().processEvents();
+    processor.loop();
+    TEST_ASSERT_EQUAL_UINT(2, presenter.numberOfChanges);
+}
+
 int main(int argc, char **argv)
 {
     UNITY_BEGIN();
 
     RUN_TEST(test_Controller);
+    RUN_TEST(test_key_press_latency);
+    RUN_TEST(test_long_press_focuses_task);
+    RUN_TEST(test_chord_toggles_each_task);
+    RUN_TEST(test_long_press_stops_tasks_without_key);
+    RUN_TEST(test_indicators_are_set_on_changes_only);
 
     UNITY_END();
 }
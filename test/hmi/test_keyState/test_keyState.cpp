@@ -2,14 +2,17 @@
 #include <Arduino-wrapper.h>
 #include <board_pins.hpp>
 #include <input_device_interface/Keypad.hpp>
+#include <input_device_interface/ScanningKeypad.hpp>
+#include <input_device_interface/VerticalCounter.hpp>
 #include <iostream>
 #include <unity.h>
+#include <vector>
 
 using namespace fakeit;
 
-static void dummyCallback(const KeyId id)
+static void dummyCallback(const KeyEvent &event)
 {
-    std::cout << "dummy callback has been called with key " << id << std::endl;
+    std::cout << "dummy callback has been called with key " << event.id << std::endl;
 }
 
 void setUp(void)
@@ -43,6 +46,163 @@ void test_switch_on_off()
     TEST_ASSERT_FALSE(keypad.isKeyPressed(KeyId::TASK1));
 }
 
+void test_events_are_processed_by_caller()
+{
+    static std::vector<KeyId> pressedKeys;
+    pressedKeys.clear();
+    Keypad keypad;
+    keypad.setCallback([](const KeyEvent &event) {
+        if (event.isPressed)
+        {
+            pressedKeys.push_back(event.id);
+        }
+    });
+
+    When(Method(ArduinoFake(), digitalRead).Using(board::button::pin::task2)).Return(LOW);
+    changeButtonState(board::button::pin::task2);
+    When(Method(ArduinoFake(), digitalRead).Using(board::button::pin::task1)).Return(LOW);
+    changeButtonState(board::button::pin::task1);
+    When(Method(ArduinoFake(), digitalRead).Using(board::button::pin::task2)).Return(HIGH);
+    changeButtonState(board::button::pin::task2);
+    TEST_ASSERT_TRUE(pressedKeys.empty()); // not called from the debouncer
+
+    keypad.processEvents();
+    TEST_ASSERT_EQUAL_UINT(2, pressedKeys.size());
+    TEST_ASSERT_TRUE(pressedKeys.at(0) == KeyId::TASK2);
+    TEST_ASSERT_TRUE(pressedKeys.at(1) == KeyId::TASK1);
+
+    keypad.processEvents();
+    TEST_ASSERT_EQUAL_UINT(2, pressedKeys.size());
+}
+
+void test_event_queue_overflow()
+{
+    Keypad keypad;
+    keypad.setCallback(dummyCallback);
+    keypad.processEvents();
+    const auto droppedBefore = keypad.getDroppedEvents();
+
+    for (int change = 0; change < 20; ++change)
+    {
+        When(Method(ArduinoFake(), digitalRead).Using(board::button::pin::enter)).Return((change % 2) ? HIGH : LOW);
+        changeButtonState(board::button::pin::enter);
+    }
+    TEST_ASSERT_EQUAL_UINT(droppedBefore + 4, keypad.getDroppedEvents());
+    keypad.processEvents();
+}
+
+void test_unchanged_state_is_no_event()
+{
+    static unsigned int numberOfEvents;
+    numberOfEvents = 0;
+    Keypad keypad;
+    keypad.setCallback([](const KeyEvent &) { numberOfEvents++; });
+    keypad.processEvents();
+    numberOfEvents = 0;
+
+    // the pin has bounced, but settled at its previous state
+    When(Method(ArduinoFake(), digitalRead).Using(board::button::pin::left)).Return(HIGH);
+    changeButtonState(board::button::pin::left);
+    keypad.processEvents();
+    TEST_ASSERT_EQUAL_UINT(0, numberOfEvents);
+
+    When(Method(ArduinoFake(), digitalRead).Using(board::button::pin::left)).Return(LOW, LOW);
+    changeButtonState(board::button::pin::left);
+    changeButtonState(board::button::pin::left);
+    keypad.processEvents();
+    TEST_ASSERT_EQUAL_UINT(1, numberOfEvents);
+    TEST_ASSERT_TRUE(keypad.isKeyPressed(KeyId::LEFT));
+
+    When(Method(ArduinoFake(), digitalRead).Using(board::button::pin::left)).Return(HIGH);
+    changeButtonState(board::button::pin::left);
+    keypad.processEvents();
+    TEST_ASSERT_EQUAL_UINT(2, numberOfEvents);
+}
+
+void test_scan_debounces_all_keys()
+{
+    static std::vector<KeyId> pressedKeys;
+    pressedKeys.clear();
+    ScanningKeypad keypad;
+    keypad.setCallback([](const KeyEvent &event) {
+        if (event.isPressed)
+        {
+            pressedKeys.push_back(event.id);
+        }
+    });
+    When(Method(ArduinoFake(), digitalRead)).AlwaysReturn(HIGH);
+    When(Method(ArduinoFake(), digitalRead).Using(board::button::pin::task3)).AlwaysReturn(LOW);
+    When(Method(ArduinoFake(), digitalRead).Using(board::button::pin::back)).AlwaysReturn(LOW);
+
+    for (unsigned int scan = 1; scan < VerticalCounter::samplesToChange; ++scan)
+    {
+        keypad.scan();
+        TEST_ASSERT_FALSE(keypad.isKeyPressed(KeyId::TASK3));
+    }
+    keypad.scan();
+    TEST_ASSERT_TRUE(keypad.isKeyPressed(KeyId::TASK3));
+    TEST_ASSERT_TRUE(keypad.isKeyPressed(KeyId::BACK));
+    TEST_ASSERT_FALSE(keypad.isKeyPressed(KeyId::TASK1));
+    TEST_ASSERT_TRUE(pressedKeys.empty()); // not called from the scan
+
+    keypad.processEvents();
+    TEST_ASSERT_EQUAL_UINT(2, pressedKeys.size());
+    TEST_ASSERT_TRUE(pressedKeys.at(0) == KeyId::TASK3);
+    TEST_ASSERT_TRUE(pressedKeys.at(1) == KeyId::BACK);
+
+    // release
+    When(Method(ArduinoFake(), digitalRead)).AlwaysReturn(HIGH);
+    for (unsigned int scan = 0; scan < VerticalCounter::samplesToChange; ++scan)
+    {
+        keypad.scan();
+    }
+    TEST_ASSERT_FALSE(keypad.isKeyPressed(KeyId::TASK3));
+    TEST_ASSERT_FALSE(keypad.isKeyPressed(KeyId::BACK));
+    keypad.processEvents();
+    TEST_ASSERT_EQUAL_UINT(2, pressedKeys.size());
+    TEST_ASSERT_EQUAL_UINT(0, keypad.getDroppedEvents());
+}
+
+void test_scan_ignores_bouncing()
+{
+    ScanningKeypad keypad;
+    keypad.setCallback(dummyCallback);
+    When(Method(ArduinoFake(), digitalRead)).AlwaysReturn(HIGH);
+
+    for (unsigned int bounce = 0; bounce < 10; ++bounce)
+    {
+        When(Method(ArduinoFake(), digitalRead).Using(board::button::pin::enter)).AlwaysReturn(bounce % 2 ? HIGH : LOW);
+        keypad.scan();
+        keypad.scan();
+        TEST_ASSERT_FALSE(keypad.isKeyPressed(KeyId::ENTER));
+    }
+}
+
+void test_vertical_counter()
+{
+    VerticalCounter counter;
+    constexpr VerticalCounter::Bits a = 0b0001;
+    constexpr VerticalCounter::Bits b = 0b0100;
+
+    TEST_ASSERT_EQUAL_HEX32(0, counter.sample(a));
+    TEST_ASSERT_EQUAL_HEX32(0, counter.sample(a | b));
+    TEST_ASSERT_EQUAL_HEX32(0, counter.sample(a | b));
+    TEST_ASSERT_EQUAL_HEX32(a, counter.sample(a | b));
+    TEST_ASSERT_EQUAL_HEX32(b, counter.sample(a | b));
+    TEST_ASSERT_EQUAL_HEX32(a | b, counter.getState());
+
+    // a single deviating sample restarts the counter
+    TEST_ASSERT_EQUAL_HEX32(0, counter.sample(0));
+    TEST_ASSERT_EQUAL_HEX32(0, counter.sample(0));
+    TEST_ASSERT_EQUAL_HEX32(0, counter.sample(a | b));
+    for (unsigned int sample = 1; sample < VerticalCounter::samplesToChange; ++sample)
+    {
+        TEST_ASSERT_EQUAL_HEX32(0, counter.sample(0));
+    }
+    TEST_ASSERT_EQUAL_HEX32(a | b, counter.sample(0));
+    TEST_ASSERT_EQUAL_HEX32(0, counter.getState());
+}
+
 int main()
 {
     // irrelevant test doubles
@@ -52,6 +212,12 @@ int main()
 
     RUN_TEST(test_default_inactive);
     RUN_TEST(test_switch_on_off);
+    RUN_TEST(test_events_are_processed_by_caller);
+    RUN_TEST(test_event_queue_overflow);
+    RUN_TEST(test_unchanged_state_is_no_event);
+    RUN_TEST(test_vertical_counter);
+    RUN_TEST(test_scan_debounces_all_keys);
+    RUN_TEST(test_scan_ignores_bouncing);
 
     return UNITY_END();
 }
@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <persistent_storage/FileStorage.hpp>
+#include <storage/TaskJournal.hpp>
+#include <string>
+#include <tasks/Task.hpp>
+#include <unity.h>
+
+static const std::filesystem::path directory = std::filesystem::temp_directory_path() / "task_tracker_test_benchmark_storage";
+
+/**
+ * Never flushes or compacts on its own; the benchmarks trigger it explicitly.
+ */
+static constexpr TaskJournal::Configuration manualConfiguration = {
+    .flushThreshold = TaskJournal::bufferSize,
+    .flushDelay = std::chrono::hours(1),
+    .compactionThreshold = SIZE_MAX,
+    .snapshotInterval = std::chrono::hours(1),
+};
+
+void setUp()
+{
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+}
+
+void tearDown()
+{
+    std::filesystem::remove_all(directory);
+}
+
+static std::uintmax_t getJournalSize()
+{
+    return std::filesystem::file_size(directory / "tasks.journal");
+}
+
+void test_benchmark_recording()
+{
+    FileStorage storage(directory.string());
+    TaskJournal journal(manualConfiguration);
+    journal.attach(storage);
+    device::TaskCollection tasks;
+    journal.restore(tasks);
+    auto &task = tasks.try_emplace(1, "foo").first->second;
+
+    constexpr int numberOfRecords = 100'000;
+    std::chrono::nanoseconds maxRecord{0};
+    std::chrono::nanoseconds maxFlush{0};
+    for (int count = 0; count < numberOfRecords; ++count)
+    {
+        const auto beforeRecord = std::chrono::steady_clock::now();
+        journal.recordStop(1, task);
+        const auto beforeFlush = std::chrono::steady_clock::now();
+        if (count % 64 == 63)
+        {
+            journal.flush();
+        }
+        const auto end = std::chrono::steady_clock::now();
+        maxRecord = std::max<std::chrono::nanoseconds>(maxRecord, beforeFlush - beforeRecord);
+        maxFlush = std::max<std::chrono::nanoseconds>(maxFlush, end - beforeFlush);
+    }
+    std::cout << numberOfRecords << " records: max. " << maxRecord.count() << "ns per record, max. "
+              << maxFlush.count() << "ns per flush, journal size " << getJournalSize() << " bytes" << std::endl;
+    TEST_ASSERT_LESS_THAN_INT64(std::chrono::nanoseconds(std::chrono::milliseconds(2)).count(), maxRecord.count());
+}
+
+void test_benchmark_replay()
+{
+    constexpr TaskId numberOfTasks = 100;
+    constexpr int numberOfRecords = 100'000;
+    {
+        FileStorage storage(directory.string());
+        TaskJournal journal(manualConfiguration);
+        journal.attach(storage);
+        device::TaskCollection tasks;
+        journal.restore(tasks);
+        for (TaskId id = 0; id < numberOfTasks; ++id)
+        {
+            tasks.try_emplace(id, "task " + std::to_string(id));
+        }
+        journal.compact(tasks);
+        for (int count = 0; count < numberOfRecords; ++count)
+        {
+            const TaskId id = (count / 2) % numberOfTasks;
+            if (count % 2 == 0)
+            {
+                journal.recordStart(id);
+            }
+            else
+            {
+                tasks.at(id).setRecordedDuration(std::chrono::seconds(count));
+                journal.recordStop(id, tasks.at(id));
+            }
+            if (count % 64 == 63)
+            {
+                journal.flush();
+            }
+        }
+        journal.flush();
+    }
+
+    FileStorage storage(directory.string());
+    TaskJournal journal;
+    journal.attach(storage);
+    device::TaskCollection tasks;
+    const auto begin = std::chrono::steady_clock::now();
+    journal.restore(tasks);
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin);
+    std::cout << "restoring " << numberOfTasks << " tasks with " << numberOfRecords << " journal entries took "
+              << elapsed.count() << "ms" << std::endl;
+
+    TEST_ASSERT_EQUAL_UINT(numberOfTasks, tasks.size());
+    TEST_ASSERT_EQUAL_INT(numberOfRecords - 1, tasks.at(numberOfTasks - 1).getRecordedDuration().count());
+    TEST_ASSERT_FALSE(tasks.at(0).isRunning());
+    TEST_ASSERT_LESS_THAN_INT64(250, elapsed.count());
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_benchmark_recording);
+    RUN_TEST(test_benchmark_replay);
+
+    return UNITY_END();
+}
@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <tasks/Task.hpp>
+#include <unity.h>
+#include <vector>
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+/**
+ * Measures the time needed to execute a function.
+ *
+ * The function is executed several times and the fastest run counts, to reduce the influence of other processes.
+ *
+ * \returns duration in microseconds
+ */
+template <class Function>
+static long long measureMicroseconds(Function function)
+{
+    constexpr int repetitions = 5;
+    auto fastest = std::chrono::steady_clock::duration::max();
+    for (int repetition = 0; repetition < repetitions; ++repetition)
+    {
+        const auto begin = std::chrono::steady_clock::now();
+        function();
+        fastest = std::min(fastest, std::chrono::steady_clock::now() - begin);
+    }
+    return std::chrono::duration_cast<std::chrono::microseconds>(fastest).count();
+}
+
+struct BenchmarkResult
+{
+    long long insert;
+    long long lookup;
+    long long iterate;
+};
+
+/**
+ * Inserts ascending IDs (as done by the serial protocol), then looks up and iterates all tasks.
+ */
+template <class Collection>
+static BenchmarkResult benchmark(const std::vector<TaskId> &lookupOrder)
+{
+    Collection tasks;
+    BenchmarkResult result;
+    result.insert = measureMicroseconds([&tasks, &lookupOrder]() {
+        tasks.clear();
+        for (TaskId id = 0; id < lookupOrder.size(); ++id)
+        {
+            tasks.try_emplace(id, "benchmark");
+        }
+    });
+    TEST_ASSERT_EQUAL_UINT(lookupOrder.size(), tasks.size());
+    std::size_t found = 0;
+    result.lookup = measureMicroseconds([&tasks, &lookupOrder, &found]() {
+        found = 0;
+        for (const TaskId id : lookupOrder)
+        {
+            found += tasks.find(id) != tasks.end();
+        }
+    });
+    TEST_ASSERT_EQUAL_UINT(lookupOrder.size(), found);
+    Task::Duration::rep sum = 0;
+    result.iterate = measureMicroseconds([&tasks, &sum]() {
+        sum = 0;
+        for (const auto &element : tasks)
+        {
+            sum += element.second.getLastRecordedDuration().count();
+        }
+    });
+    TEST_ASSERT_EQUAL_INT(0, sum);
+    return result;
+}
+
+/**
+ * Compares the flat container with `std::map`, which has been used before.
+ *
+ * The flat container is meant to be faster in looking up and iterating, which is done far more often than inserting.
+ * Inserting is not compared, as the flat container is expected to be slower for huge numbers of tasks.
+ * The advantage is only asserted for the largest number of tasks, where the durations are long enough to be measured reliably.
+ * This suite is built with optimization and without coverage instrumentation, see the environment `native_benchmark`.
+ */
+void test_benchmark_against_map()
+{
+    std::cout << std::setw(8) << "tasks" << std::setw(10) << "container"
+              << std::setw(12) << "insert/us" << std::setw(12) << "lookup/us" << std::setw(12) << "iterate/us" << std::endl;
+    for (const std::size_t numberOfTasks : {10U, 1'000U, 50'000U})
+    {
+        std::vector<TaskId> lookupOrder(numberOfTasks);
+        for (TaskId id = 0; id < numberOfTasks; ++id)
+        {
+            lookupOrder[id] = id;
+        }
+        std::shuffle(std::begin(lookupOrder), std::end(lookupOrder), std::mt19937(numberOfTasks));
+
+        const auto flat = benchmark<device::TaskCollection>(lookupOrder);
+        const auto tree = benchmark<std::map<TaskId, Task>>(lookupOrder);
+        for (const auto &[name, result] : {std::make_pair("flat", flat), std::make_pair("std::map", tree)})
+        {
+            std::cout << std::setw(8) << numberOfTasks << std::setw(10) << name
+                      << std::setw(12) << result.insert << std::setw(12) << result.lookup << std::setw(12) << result.iterate << std::endl;
+        }
+        if (numberOfTasks >= 50'000U)
+        {
+            TEST_ASSERT_LESS_THAN_INT64(tree.lookup, flat.lookup);
+            TEST_ASSERT_LESS_THAN_INT64(tree.iterate, flat.iterate);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_benchmark_against_map);
+
+    return UNITY_END();
+}
@@ -0,0 +1,51 @@
+#include "../helpers/create_tasks.hpp"
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <tasks/Task.hpp>
+#include <unity.h>
+#include <user_interaction/TaskListWindow.hpp>
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+/**
+ * Scrolls through the whole list, one step per row, as the GUI does.
+ */
+static std::chrono::nanoseconds measureScrolling(const TaskId numberOfTasks)
+{
+    device::TaskCollection tasks;
+    createTasks(tasks, numberOfTasks);
+    TaskListWindow window;
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t first = 0; first < numberOfTasks; ++first)
+    {
+        window.request(first);
+        window.update(tasks);
+        TEST_ASSERT_TRUE(window.takePage().has_value() || (first + TaskListWindow::visibleRows > numberOfTasks));
+    }
+    return (std::chrono::steady_clock::now() - start) / numberOfTasks;
+}
+
+void test_benchmark_scroll_step_is_independent_of_the_number_of_tasks()
+{
+    const auto few = measureScrolling(50);
+    const auto many = measureScrolling(5'000);
+    std::cout << "scroll step: " << few.count() << " ns with 50 tasks, " << many.count() << " ns with 5000 tasks" << std::endl;
+    TEST_ASSERT_TRUE(many < 4 * few + std::chrono::microseconds(1));
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_benchmark_scroll_step_is_independent_of_the_number_of_tasks);
+
+    return UNITY_END();
+}
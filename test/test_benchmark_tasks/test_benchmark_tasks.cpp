@@ -0,0 +1,43 @@
+#include "../test_tasks/ManualClock.hpp"
+#include <chrono>
+#include <iostream>
+#include <tasks/Task.hpp>
+#include <unity.h>
+
+typedef BasicTask<ManualClock> ManualTask;
+
+void setUp()
+{
+    ManualClock::reset();
+}
+
+void tearDown()
+{
+}
+
+void test_benchmark_start_stop()
+{
+    ManualTask task("benchmark");
+    constexpr long long numberOfIntervals = 1'000'000;
+    const auto begin = std::chrono::steady_clock::now();
+    for (long long interval = 0; interval < numberOfIntervals; ++interval)
+    {
+        task.start();
+        ManualClock::advance(std::chrono::milliseconds(1));
+        task.stop();
+    }
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin);
+    std::cout << numberOfIntervals << " start/stop cycles took " << elapsed.count() << "us" << std::endl;
+    TEST_ASSERT_EQUAL_INT64(numberOfIntervals / 1'000, task.getRecordedDuration().count());
+    // the history has a fixed capacity, so a cycle must not get slower with the number of cycles; 1us on average
+    TEST_ASSERT_LESS_THAN_INT64(numberOfIntervals, elapsed.count());
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_benchmark_start_stop);
+
+    return UNITY_END();
+}
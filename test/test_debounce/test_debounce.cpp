@@ -0,0 +1,166 @@
+#include <atomic>
+#include <chrono>
+#include <input_device_interface/DebounceScheduler.hpp>
+#include <input_device_interface/ThreadedDebounceService.hpp>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <unity.h>
+
+using namespace std::chrono_literals;
+
+typedef std::chrono::steady_clock Clock;
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_handler_is_called_after_debounce_time()
+{
+    unsigned int calls = 0;
+    DebounceScheduler<Clock, 2> scheduler;
+    const auto id = scheduler.addChannel([&calls](Clock::time_point) { ++calls; }, 20ms);
+    const Clock::time_point start{};
+
+    TEST_ASSERT_FALSE(scheduler.process(start).has_value()); // nothing pending
+    scheduler.signal(id, start);
+    TEST_ASSERT_TRUE(scheduler.process(start) == 20ms);
+    TEST_ASSERT_TRUE(scheduler.process(start + 19ms) == 1ms);
+    TEST_ASSERT_EQUAL_UINT(0, calls);
+    TEST_ASSERT_FALSE(scheduler.process(start + 20ms).has_value());
+    TEST_ASSERT_EQUAL_UINT(1, calls);
+    TEST_ASSERT_FALSE(scheduler.process(start + 100ms).has_value());
+    TEST_ASSERT_EQUAL_UINT(1, calls);
+}
+
+void test_signal_restarts_debounce_time()
+{
+    unsigned int calls = 0;
+    DebounceScheduler<Clock, 2> scheduler;
+    const auto id = scheduler.addChannel([&calls](Clock::time_point) { ++calls; }, 20ms);
+    const Clock::time_point start{};
+
+    // bouncing signal
+    for (auto now = start; now < start + 50ms; now += 5ms)
+    {
+        scheduler.signal(id, now);
+        TEST_ASSERT_TRUE(scheduler.process(now) == 20ms);
+    }
+    TEST_ASSERT_EQUAL_UINT(0, calls);
+    scheduler.process(start + 64ms);
+    TEST_ASSERT_EQUAL_UINT(0, calls);
+    scheduler.process(start + 65ms);
+    TEST_ASSERT_EQUAL_UINT(1, calls);
+}
+
+void test_channels_are_independent()
+{
+    unsigned int callsA = 0;
+    unsigned int callsB = 0;
+    DebounceScheduler<Clock, 2> scheduler;
+    const auto idA = scheduler.addChannel([&callsA](Clock::time_point) { ++callsA; }, 20ms);
+    const auto idB = scheduler.addChannel([&callsB](Clock::time_point) { ++callsB; }, 50ms);
+    TEST_ASSERT_EQUAL_UINT(2, scheduler.size());
+    const Clock::time_point start{};
+
+    scheduler.signal(idB, start);
+    scheduler.process(start);
+    scheduler.signal(idA, start + 10ms);
+    TEST_ASSERT_TRUE(scheduler.process(start + 10ms) == 20ms); // earliest deadline wins
+    TEST_ASSERT_TRUE(scheduler.process(start + 30ms) == 20ms);
+    TEST_ASSERT_EQUAL_UINT(1, callsA);
+    TEST_ASSERT_EQUAL_UINT(0, callsB);
+    TEST_ASSERT_FALSE(scheduler.process(start + 50ms).has_value());
+    TEST_ASSERT_EQUAL_UINT(1, callsA);
+    TEST_ASSERT_EQUAL_UINT(1, callsB);
+}
+
+void test_handler_gets_first_signal()
+{
+    std::vector<Clock::time_point> calls;
+    DebounceScheduler<Clock, 1> scheduler;
+    const auto id = scheduler.addChannel([&calls](const Clock::time_point firstSignal) { calls.push_back(firstSignal); }, 20ms);
+    const Clock::time_point start{};
+
+    // the signal is processed later than it occurred
+    scheduler.signal(id, start);
+    scheduler.signal(id, start + 1ms);
+    scheduler.process(start + 3ms);
+    scheduler.signal(id, start + 5ms);
+    scheduler.process(start + 6ms);
+    scheduler.process(start + 26ms);
+    TEST_ASSERT_EQUAL_UINT(1, calls.size());
+    TEST_ASSERT_TRUE(calls.at(0) == start);
+
+    // next burst
+    scheduler.signal(id, start + 100ms);
+    scheduler.process(start + 101ms);
+    scheduler.process(start + 121ms);
+    TEST_ASSERT_EQUAL_UINT(2, calls.size());
+    TEST_ASSERT_TRUE(calls.at(1) == start + 100ms);
+}
+
+void test_number_of_channels_is_limited()
+{
+    DebounceScheduler<Clock, 1> scheduler;
+    scheduler.addChannel([](Clock::time_point) {}, 20ms);
+    try
+    {
+        scheduler.addChannel([](Clock::time_point) {}, 20ms);
+        TEST_FAIL_MESSAGE("exception has not been thrown for too many channels");
+    }
+    catch (const std::length_error &)
+    {
+    }
+}
+
+void test_threaded_service_debounces_bouncing_signal()
+{
+    std::atomic<unsigned int> calls{0};
+    std::atomic<Clock::rep> calledAt{0};
+    std::atomic<Clock::rep> reportedFirstSignal{0};
+    ThreadedDebounceService<> service;
+    const auto signal = service.createDebouncer(
+        [&](const Clock::time_point firstSignal) {
+            calledAt = Clock::now().time_since_epoch().count();
+            reportedFirstSignal = firstSignal.time_since_epoch().count();
+            ++calls;
+        },
+        20ms);
+
+    const Clock::time_point firstSignal = Clock::now();
+    Clock::time_point lastSignal;
+    for (unsigned int bounce = 0; bounce < 10; ++bounce)
+    {
+        lastSignal = Clock::now();
+        signal();
+        std::this_thread::sleep_for(5ms);
+    }
+    std::this_thread::sleep_for(100ms);
+
+    TEST_ASSERT_EQUAL_UINT(1, calls.load());
+    const auto delay = Clock::time_point(Clock::duration(calledAt.load())) - lastSignal;
+    TEST_ASSERT_TRUE(delay >= 20ms);
+    TEST_ASSERT_TRUE(delay < 70ms);
+    const auto firstSignalError = Clock::time_point(Clock::duration(reportedFirstSignal.load())) - firstSignal;
+    TEST_ASSERT_TRUE(firstSignalError >= 0ms);
+    TEST_ASSERT_TRUE(firstSignalError < 5ms);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_handler_is_called_after_debounce_time);
+    RUN_TEST(test_signal_restarts_debounce_time);
+    RUN_TEST(test_channels_are_independent);
+    RUN_TEST(test_handler_gets_first_signal);
+    RUN_TEST(test_number_of_channels_is_limited);
+    RUN_TEST(test_threaded_service_debounces_bouncing_signal);
+
+    return UNITY_END();
+}
@@ -0,0 +1,78 @@
+#include <display_interface/DirtyPages.hpp>
+#include <unity.h>
+#include <vector>
+
+typedef page_layout::Area Area;
+typedef DirtyPages::Window Window;
+
+static std::vector<Window> getWindows(const DirtyPages &dirtyPages)
+{
+    std::vector<Window> windows;
+    dirtyPages.forEachWindow([&windows](const Window &window) { windows.push_back(window); });
+    return windows;
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_nothing_to_transfer_when_clean()
+{
+    DirtyPages dirtyPages;
+    TEST_ASSERT_TRUE(dirtyPages.isClean());
+    TEST_ASSERT_TRUE(getWindows(dirtyPages).empty());
+}
+
+void test_window_covers_marked_columns_and_pages()
+{
+    DirtyPages dirtyPages;
+    dirtyPages.mark(Area{.x1 = 10, .y1 = 8, .x2 = 20, .y2 = 15});
+    dirtyPages.mark(Area{.x1 = 5, .y1 = 16, .x2 = 12, .y2 = 23});
+    TEST_ASSERT_FALSE(dirtyPages.isClean());
+    const auto windows = getWindows(dirtyPages);
+    TEST_ASSERT_EQUAL_UINT(1, windows.size());
+    TEST_ASSERT_EQUAL_INT(5, windows.at(0).x1);
+    TEST_ASSERT_EQUAL_INT(20, windows.at(0).x2);
+    TEST_ASSERT_EQUAL_INT(1, windows.at(0).firstPage);
+    TEST_ASSERT_EQUAL_INT(2, windows.at(0).lastPage);
+    TEST_ASSERT_EQUAL_UINT(32, windows.at(0).getNumberOfBytes());
+}
+
+void test_unchanged_pages_separate_windows()
+{
+    DirtyPages dirtyPages;
+    dirtyPages.mark(Area{.x1 = 0, .y1 = 0, .x2 = 127, .y2 = 7});
+    dirtyPages.mark(Area{.x1 = 100, .y1 = 56, .x2 = 110, .y2 = 63});
+    const auto windows = getWindows(dirtyPages);
+    TEST_ASSERT_EQUAL_UINT(2, windows.size());
+    TEST_ASSERT_EQUAL_INT(0, windows.at(0).firstPage);
+    TEST_ASSERT_EQUAL_INT(0, windows.at(0).lastPage);
+    TEST_ASSERT_EQUAL_INT(7, windows.at(1).firstPage);
+    TEST_ASSERT_EQUAL_INT(100, windows.at(1).x1);
+    TEST_ASSERT_EQUAL_UINT(128 + 11, windows.at(0).getNumberOfBytes() + windows.at(1).getNumberOfBytes());
+}
+
+void test_clear()
+{
+    DirtyPages dirtyPages;
+    dirtyPages.mark(Area{.x1 = 0, .y1 = 0, .x2 = 127, .y2 = 63});
+    dirtyPages.clear();
+    TEST_ASSERT_TRUE(dirtyPages.isClean());
+    TEST_ASSERT_TRUE(getWindows(dirtyPages).empty());
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_nothing_to_transfer_when_clean);
+    RUN_TEST(test_window_covers_marked_columns_and_pages);
+    RUN_TEST(test_unchanged_pages_separate_windows);
+    RUN_TEST(test_clear);
+
+    return UNITY_END();
+}
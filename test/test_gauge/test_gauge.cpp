@@ -0,0 +1,86 @@
+#include <atomic>
+#include <gauge.hpp>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unity.h>
+#include <vector>
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_latest_and_maximum_are_kept()
+{
+    static Gauge gauge("test", "us"); // gauges cannot unregister
+    TEST_ASSERT_EQUAL_UINT32(0, gauge.getLatest());
+    TEST_ASSERT_EQUAL_UINT32(0, gauge.getMaximum());
+
+    gauge.set(30);
+    gauge.set(70);
+    gauge.set(20);
+    TEST_ASSERT_EQUAL_UINT32(20, gauge.getLatest());
+    TEST_ASSERT_EQUAL_UINT32(70, gauge.getMaximum());
+}
+
+void test_all_gauges_are_printed()
+{
+    static Gauge gauge("heap", "bytes");
+    gauge.set(1'024);
+    gauge.set(512);
+    std::ostringstream output;
+    Gauge::printAll(output);
+    TEST_ASSERT_TRUE(output.str().find("heap: 512 bytes (maximum 1024 bytes)") != std::string::npos);
+}
+
+void test_gauges_are_registered_concurrently()
+{
+    constexpr int numberOfThreads = 4;
+    constexpr int gaugesPerThread = 10'000;
+    std::atomic<int> waiting{numberOfThreads};
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < numberOfThreads; ++thread)
+    {
+        threads.emplace_back([&waiting]() {
+            // start at once, so the registrations overlap
+            --waiting;
+            while (waiting > 0)
+            {
+                std::this_thread::yield();
+            }
+            for (int gauge = 0; gauge < gaugesPerThread; ++gauge)
+            {
+                new Gauge("concurrent", "us"); // gauges cannot unregister, thus they are never deleted
+            }
+        });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    std::ostringstream output;
+    Gauge::printAll(output);
+    const std::string printed = output.str();
+    int numberOfPrinted = 0;
+    for (auto position = printed.find("concurrent:"); position != std::string::npos; position = printed.find("concurrent:", position + 1))
+    {
+        ++numberOfPrinted;
+    }
+    TEST_ASSERT_EQUAL_INT(numberOfThreads * gaugesPerThread, numberOfPrinted);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_latest_and_maximum_are_kept);
+    RUN_TEST(test_all_gauges_are_printed);
+    RUN_TEST(test_gauges_are_registered_concurrently);
+
+    return UNITY_END();
+}
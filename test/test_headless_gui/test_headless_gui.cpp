@@ -0,0 +1,427 @@
+#include <LVGL/HeadlessGuiEngine.hpp>
+#include <LVGL/Screen.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <tasks/Task.hpp>
+#include <unity.h>
+#include <user_interaction/IKeypad.hpp>
+#include <user_interaction/Menu.hpp>
+#include <user_interaction/MenuItem.hpp>
+
+using namespace std::chrono_literals;
+
+constexpr page_layout::Coordinate displayWidth = 128;
+constexpr page_layout::Coordinate displayHeight = 64;
+
+/**
+ * Time available for rendering a frame.
+ */
+constexpr std::chrono::milliseconds frameBudget{LV_DISP_DEF_REFR_PERIOD};
+
+/**
+ * Keypad whose keys are pressed by the test.
+ */
+class FakeKeypad : public IKeypad
+{
+  public:
+    void setCallback(const HmiHandler) override
+    {
+    }
+
+    bool isKeyPressed(const KeyId keyInquiry) override
+    {
+        return pressedKeys.count(keyInquiry) > 0;
+    }
+
+    void setEventNotification(const std::function<void(void)>) override
+    {
+    }
+
+    void processEvents() override
+    {
+    }
+
+    std::size_t getDroppedEvents() const override
+    {
+        return 0;
+    }
+
+    std::set<KeyId> pressedKeys;
+};
+
+static FakeKeypad keypad;
+
+/**
+ * LVGL can be initialized only once.
+ */
+static HeadlessGuiEngine &getEngine()
+{
+    static HeadlessGuiEngine engine(displayWidth, displayHeight);
+    return engine;
+}
+
+/**
+ * Lets LVGL redraw what has changed.
+ */
+static void renderFrame()
+{
+    getEngine().skipTime(std::chrono::milliseconds(LV_DISP_DEF_REFR_PERIOD));
+    getEngine().refresh();
+}
+
+/**
+ * Lets LVGL read a key being pressed and released, and redraw afterwards.
+ */
+static void tapKey(const KeyId key)
+{
+    keypad.pressedKeys.insert(key);
+    getEngine().skipTime(std::chrono::milliseconds(LV_INDEV_DEF_READ_PERIOD));
+    getEngine().refresh();
+    keypad.pressedKeys.erase(key);
+    getEngine().skipTime(std::chrono::milliseconds(LV_INDEV_DEF_READ_PERIOD));
+    getEngine().refresh();
+    renderFrame();
+}
+
+/**
+ * \returns the current frame as portable bitmap
+ */
+static std::string captureFrame()
+{
+    std::ostringstream output(std::ios::binary);
+    getEngine().writePbm(output);
+    return output.str();
+}
+
+/**
+ * Writes the current frame into the directory given by the environment variable `PBM_DIRECTORY`, if it is set.
+ */
+static void dumpFrame(const std::string &name)
+{
+    const char *const directory = std::getenv("PBM_DIRECTORY");
+    if (directory)
+    {
+        std::ofstream file(std::string(directory) + "/" + name + ".pbm", std::ios::binary);
+        getEngine().writePbm(file);
+    }
+}
+
+static std::size_t countPixelsOn()
+{
+    std::size_t count = 0;
+    for (page_layout::Coordinate y = 0; y < displayHeight; ++y)
+    {
+        for (page_layout::Coordinate x = 0; x < displayWidth; ++x)
+        {
+            count += getEngine().isPixelOn(x, y) ? 1 : 0;
+        }
+    }
+    return count;
+}
+
+void setUp()
+{
+    keypad.pressedKeys.clear();
+}
+
+void tearDown()
+{
+}
+
+void test_main_menu_is_rendered()
+{
+    static Menu menu(getEngine(), keypad);
+    renderFrame();
+    dumpFrame("main_menu");
+
+    const std::size_t pixelsOn = countPixelsOn();
+    TEST_ASSERT_GREATER_THAN_UINT(0, pixelsOn);
+    TEST_ASSERT_LESS_THAN_UINT(displayWidth * displayHeight / 2, pixelsOn); // mostly text on a dark background
+    TEST_ASSERT_GREATER_THAN_UINT(0, getEngine().getTimings().flushedAreas);
+
+    const std::string frame = captureFrame();
+    const std::string header = "P4\n128 64\n";
+    TEST_ASSERT_EQUAL_UINT(header.size() + displayHeight * displayWidth / 8, frame.size());
+    TEST_ASSERT_EQUAL_STRING(header.c_str(), frame.substr(0, header.size()).c_str());
+}
+
+void test_submenu_is_entered_and_left()
+{
+    // the first item is a sub menu and focused
+    const std::string mainMenu = captureFrame();
+    tapKey(KeyId::ENTER);
+    dumpFrame("sub_menu");
+    const std::string subMenu = captureFrame();
+    TEST_ASSERT_TRUE(subMenu != mainMenu);
+
+    tapKey(KeyId::BACK);
+    TEST_ASSERT_TRUE(captureFrame() == mainMenu);
+}
+
+void test_value_modifier_is_entered_and_left()
+{
+    static double value = 12.5;
+    static MenuItemValue valueItem("Value", &value, 1, 0.0, 100.0);
+    static MenuItemList valueMenu = {&valueItem};
+    getEngine().drawMenu(&valueMenu);
+    renderFrame();
+    const std::string menu = captureFrame();
+
+    tapKey(KeyId::ENTER);
+    dumpFrame("value_modifier");
+    TEST_ASSERT_TRUE(captureFrame() != menu);
+
+    const std::string unchangedModifier = captureFrame();
+    tapKey(KeyId::ENTER); // the increment button is focused first
+    TEST_ASSERT_TRUE(captureFrame() != unchangedModifier);
+
+    tapKey(KeyId::BACK);
+    TEST_ASSERT_TRUE(captureFrame() == menu);
+    TEST_ASSERT_TRUE(value == 12.5); // the GUI only requests the change
+    valueItem.synchronize();
+    TEST_ASSERT_TRUE(std::abs(value - 12.6) < 1e-9);
+}
+
+static std::size_t getUsedLvglHeap()
+{
+    lv_mem_monitor_t monitor;
+    lv_mem_monitor(&monitor);
+    return monitor.total_size - monitor.free_size;
+}
+
+/**
+ * Drawing the screens again must neither set up their styles again nor leak LVGL heap.
+ */
+void test_redrawing_keeps_heap_flat()
+{
+    static bool state = false;
+    static double value = 1.0;
+    static MenuItemValue valueItem("Value", &value, 1, 0.0, 100.0);
+    static MenuItemSwitch switchItem("Switch", &state);
+    static MenuItemList menu = {&valueItem, &switchItem};
+    const auto drawScreens = []() {
+        getEngine().drawMenu(&menu);
+        renderFrame();
+        tapKey(KeyId::ENTER); // builds the value modifier
+        tapKey(KeyId::BACK);  // deletes it
+    };
+    drawScreens();
+    const std::size_t usedHeap = getUsedLvglHeap();
+
+    for (int repetition = 0; repetition < 1000; ++repetition)
+    {
+        drawScreens();
+    }
+    renderFrame();
+    TEST_ASSERT_EQUAL_UINT(usedHeap, getUsedLvglHeap());
+}
+
+/**
+ * Navigates through nested menus with the keys, like a user does, through the screen history.
+ *
+ * The innermost menu leads back to the outermost one, so entering more screens than the history holds is tried as well.
+ */
+void test_navigation_keeps_heap_flat()
+{
+    static double value = 1.0;
+    static MenuItemValue valueItem("Value", &value, 1, 0.0, 100.0);
+    static MenuItemList outerMenu;
+    static MenuItemSubmenu cycleItem("Outer", &outerMenu);
+    static MenuItemList innerMenu = {&valueItem, &cycleItem};
+    static MenuItemSubmenu innerItem("Inner", &innerMenu);
+    static MenuItemList middleMenu = {&innerItem};
+    static MenuItemSubmenu middleItem("Middle", &middleMenu);
+    outerMenu = {&middleItem};
+    const auto navigate = []() {
+        tapKey(KeyId::ENTER); // middle menu
+        tapKey(KeyId::ENTER); // inner menu
+        tapKey(KeyId::ENTER); // value modifier
+        TEST_ASSERT_EQUAL_UINT(maxScreenDepth, screenHistory.size());
+        tapKey(KeyId::BACK);
+        tapKey(KeyId::RIGHT);
+        tapKey(KeyId::ENTER); // outer menu again
+        TEST_ASSERT_EQUAL_UINT(maxScreenDepth, screenHistory.size());
+        tapKey(KeyId::ENTER); // refused, as the history is full
+        TEST_ASSERT_EQUAL_UINT(maxScreenDepth, screenHistory.size());
+        tapKey(KeyId::BACK);
+        tapKey(KeyId::LEFT); // the value item is focused again, as at the beginning
+        tapKey(KeyId::BACK);
+        tapKey(KeyId::BACK);
+        TEST_ASSERT_EQUAL_UINT(1, screenHistory.size());
+    };
+    getEngine().drawMenu(&outerMenu);
+    renderFrame();
+    const std::string outerFrame = captureFrame();
+    navigate();
+    renderFrame();
+    TEST_ASSERT_TRUE(captureFrame() == outerFrame);
+    const std::size_t usedHeap = getUsedLvglHeap();
+
+    for (int repetition = 0; repetition < 100; ++repetition)
+    {
+        navigate();
+    }
+    renderFrame();
+    TEST_ASSERT_TRUE(captureFrame() == outerFrame);
+    TEST_ASSERT_EQUAL_UINT(usedHeap, getUsedLvglHeap());
+}
+
+/**
+ * Lets the task list receive the rows it has requested, like the main loop does.
+ */
+static void deliverTasks(TaskListWindow &window, const device::TaskCollection &tasks)
+{
+    window.update(tasks);
+    getEngine().skipTime(100ms);
+    getEngine().refresh();
+    renderFrame();
+}
+
+void test_task_list_scrolls_with_constant_heap()
+{
+    static device::TaskCollection tasks;
+    constexpr TaskId numberOfTasks = 5000;
+    tasks.reserve(numberOfTasks);
+    for (TaskId id = 0; id < numberOfTasks; ++id)
+    {
+        tasks.try_emplace(id, "Task " + std::to_string(id));
+    }
+    static TaskListWindow window;
+    static MenuItemTaskList taskListItem("Tasks", &window);
+    static MenuItemList taskListMenu = {&taskListItem};
+    getEngine().drawMenu(&taskListMenu);
+    renderFrame();
+
+    tapKey(KeyId::ENTER);
+    deliverTasks(window, tasks);
+    dumpFrame("task_list");
+    const std::string firstPage = captureFrame();
+    const std::size_t usedHeap = getUsedLvglHeap();
+
+    for (int step = 0; step < 100; ++step)
+    {
+        tapKey(KeyId::RIGHT);
+        deliverTasks(window, tasks);
+    }
+    TEST_ASSERT_TRUE(captureFrame() != firstPage);
+    TEST_ASSERT_EQUAL_UINT(usedHeap, getUsedLvglHeap());
+
+    for (int step = 0; step < 100; ++step)
+    {
+        tapKey(KeyId::LEFT);
+        deliverTasks(window, tasks);
+    }
+    TEST_ASSERT_TRUE(captureFrame() == firstPage);
+    TEST_ASSERT_EQUAL_UINT(usedHeap, getUsedLvglHeap());
+
+    tapKey(KeyId::BACK);
+    deliverTasks(window, tasks);
+    TEST_ASSERT_FALSE(window.takePage().has_value()); // closed
+}
+
+/**
+ * Lets a second pass for the dashboard and sums up what has been redrawn.
+ *
+ * \returns the number of pixels flushed
+ */
+static std::uint32_t passSecond()
+{
+    getEngine().skipTime(1s);
+    std::uint32_t flushedPixels = 0;
+    // the timer of the dashboard and the redraw may be processed in either order
+    for (int frame = 0; frame < 2; ++frame)
+    {
+        getEngine().refresh();
+        flushedPixels += getEngine().getTimings().flushedPixels;
+        getEngine().skipTime(std::chrono::milliseconds(LV_DISP_DEF_REFR_PERIOD));
+    }
+    return flushedPixels;
+}
+
+void test_dashboard_redraws_only_the_seconds()
+{
+    static device::TaskCollection tasks;
+    constexpr TaskId numberOfTasks = 50;
+    tasks.reserve(numberOfTasks);
+    for (TaskId id = 0; id < numberOfTasks; ++id)
+    {
+        tasks.try_emplace(id, "Task " + std::to_string(id));
+    }
+    tasks.at(7).start();
+    static TaskDashboard dashboard;
+    static MenuItemDashboard dashboardItem("Dashboard", &dashboard);
+    static MenuItemList dashboardMenu = {&dashboardItem};
+    getEngine().drawMenu(&dashboardMenu);
+    renderFrame();
+
+    tapKey(KeyId::ENTER);
+    dashboard.update(tasks);
+    getEngine().skipTime(100ms);
+    getEngine().refresh();
+    renderFrame();
+    dumpFrame("dashboard");
+    const std::string firstFrame = captureFrame();
+
+    std::uint32_t maximumFlushedPixels = 0;
+    for (int second = 0; second < 5; ++second)
+    {
+        maximumFlushedPixels = std::max(maximumFlushedPixels, passSecond());
+    }
+    std::cout << "dashboard: at most " << maximumFlushedPixels << " pixels redrawn per second" << std::endl;
+    TEST_ASSERT_TRUE(captureFrame() != firstFrame);
+    // only the duration label of the running task in the first row: "0:00:00" in the 8 pixels wide default font
+    constexpr std::uint32_t durationLabelWidth = 7 * 8;
+    TEST_ASSERT_GREATER_THAN_UINT(0, maximumFlushedPixels);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT(durationLabelWidth * page_layout::pageHeight, maximumFlushedPixels);
+
+    // nothing is redrawn as long as the shown seconds do not change
+    getEngine().skipTime(std::chrono::milliseconds(LV_DISP_DEF_REFR_PERIOD));
+    getEngine().refresh();
+    TEST_ASSERT_EQUAL_UINT(0, getEngine().getTimings().flushedPixels);
+
+    tapKey(KeyId::BACK);
+}
+
+/**
+ * Redraws the whole screen and compares the durations against the time available per frame.
+ */
+void test_benchmark_full_frame()
+{
+    constexpr int repetitions = 20;
+    HeadlessGuiEngine::Clock::duration maximumRender{0};
+    HeadlessGuiEngine::Clock::duration maximumFlush{0};
+    for (int repetition = 0; repetition < repetitions; ++repetition)
+    {
+        lv_obj_invalidate(lv_scr_act());
+        renderFrame();
+        maximumRender = std::max(maximumRender, getEngine().getTimings().render);
+        maximumFlush = std::max(maximumFlush, getEngine().getTimings().flush);
+    }
+    std::cout << "full frame: render " << std::chrono::duration_cast<std::chrono::microseconds>(maximumRender).count()
+              << " us, flush " << std::chrono::duration_cast<std::chrono::microseconds>(maximumFlush).count() << " us" << std::endl;
+    TEST_ASSERT_TRUE(maximumRender < frameBudget);
+    TEST_ASSERT_TRUE(maximumFlush < frameBudget / 30);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_main_menu_is_rendered);
+    RUN_TEST(test_submenu_is_entered_and_left);
+    RUN_TEST(test_value_modifier_is_entered_and_left);
+    RUN_TEST(test_redrawing_keeps_heap_flat);
+    RUN_TEST(test_navigation_keeps_heap_flat);
+    RUN_TEST(test_task_list_scrolls_with_constant_heap);
+    RUN_TEST(test_dashboard_redraws_only_the_seconds);
+    RUN_TEST(test_benchmark_full_frame);
+
+    return UNITY_END();
+}
@@ -0,0 +1,154 @@
+#include "../helpers/counting_new.hpp"
+#include <array>
+#include <cstddef>
+#include <inplace_stack.hpp>
+#include <string>
+#include <unity.h>
+
+/**
+ * Records which screens are drawn and destroyed.
+ */
+static std::string events;
+
+class Screen
+{
+  public:
+    virtual ~Screen() = default;
+    virtual void draw() = 0;
+};
+
+/**
+ * Stands in for a menu screen.
+ */
+class Menu final : public Screen
+{
+  public:
+    Menu(const char name)
+        : name(name)
+    {
+    }
+
+    ~Menu() override
+    {
+        events += '~';
+        events += name;
+    }
+
+    void draw() override
+    {
+        events += name;
+    }
+
+  private:
+    const char name;
+};
+
+/**
+ * Stands in for a value modifier screen, which is larger than a menu and has a second base.
+ */
+class Modifier final : public std::array<double, 4>, public Screen
+{
+  public:
+    Modifier(const double value)
+        : std::array<double, 4>{value}
+    {
+    }
+
+    ~Modifier() override
+    {
+        events += "~v";
+    }
+
+    void draw() override
+    {
+        events += 'v';
+    }
+};
+
+typedef InplaceStack<Screen, 4, Menu, Modifier> History;
+
+void setUp()
+{
+    events.clear();
+    events.reserve(4096); // recording must not allocate during the navigation
+}
+
+void tearDown()
+{
+}
+
+void test_push_and_pop()
+{
+    History history;
+    TEST_ASSERT_TRUE(history.empty());
+    TEST_ASSERT_EQUAL_UINT(4, History::capacity());
+
+    history.push<Menu>('a')->draw();
+    history.push<Modifier>(1.5)->draw();
+    TEST_ASSERT_EQUAL_UINT(2, history.size());
+    history.top().draw();
+    TEST_ASSERT_EQUAL_STRING("avv", events.c_str());
+
+    history.pop();
+    history.top().draw();
+    TEST_ASSERT_EQUAL_STRING("avv~va", events.c_str());
+    TEST_ASSERT_EQUAL_UINT(1, history.size());
+}
+
+void test_push_fails_when_full()
+{
+    History history;
+    for (std::size_t level = 0; level < History::capacity(); ++level)
+    {
+        TEST_ASSERT_NOT_NULL(history.push<Menu>('a'));
+    }
+    TEST_ASSERT_TRUE(history.full());
+    TEST_ASSERT_NULL(history.push<Modifier>(0.0));
+    TEST_ASSERT_EQUAL_UINT(History::capacity(), history.size());
+}
+
+void test_objects_are_destroyed_from_the_top()
+{
+    {
+        History history;
+        history.push<Menu>('a');
+        history.push<Menu>('b');
+        history.push<Modifier>(0.0);
+    }
+    TEST_ASSERT_EQUAL_STRING("~v~b~a", events.c_str());
+}
+
+void test_navigation_does_not_allocate()
+{
+    static History history;
+    numberOfAllocations = 0;
+
+    // enter the main menu, a sub menu, a value and go back, as the GUI does
+    for (int repetition = 0; repetition < 100; ++repetition)
+    {
+        history.clear();
+        history.push<Menu>('m')->draw();
+        history.push<Menu>('s')->draw();
+        history.push<Modifier>(2.5)->draw();
+        history.pop();
+        history.top().draw();
+        history.push<Menu>('t')->draw();
+        history.pop();
+        history.pop();
+        history.top().draw();
+    }
+    TEST_ASSERT_EQUAL_UINT(0, numberOfAllocations);
+    TEST_ASSERT_EQUAL_UINT(1, history.size());
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_push_and_pop);
+    RUN_TEST(test_push_fails_when_full);
+    RUN_TEST(test_objects_are_destroyed_from_the_top);
+    RUN_TEST(test_navigation_does_not_allocate);
+
+    return UNITY_END();
+}
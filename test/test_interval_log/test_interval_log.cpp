@@ -0,0 +1,111 @@
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <tasks/IntervalLog.hpp>
+#include <unity.h>
+#include <varint.hpp>
+
+using namespace std::chrono_literals;
+
+typedef IntervalLog<std::chrono::steady_clock, 16, 3> SmallLog;
+
+static SmallLog::TimePoint at(const std::chrono::seconds sinceEpoch)
+{
+    return SmallLog::TimePoint(sinceEpoch);
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_varint_round_trip()
+{
+    for (const std::uint32_t value : {0U, 1U, 127U, 128U, 3'600U, 16'383U, 16'384U, 0xFFFF'FFFFU})
+    {
+        std::array<std::uint8_t, maxVarintSize<std::uint32_t>> buffer;
+        const auto end = encodeVarint(value, buffer.data());
+        TEST_ASSERT_EQUAL_UINT(getVarintSize(value), end - buffer.data());
+        std::uint32_t decoded;
+        TEST_ASSERT_EQUAL_PTR(end, decodeVarint(buffer.data(), end, decoded));
+        TEST_ASSERT_EQUAL_UINT32(value, decoded);
+    }
+    const std::uint8_t truncated[] = {0x80, 0x80};
+    std::uint32_t decoded;
+    TEST_ASSERT_NULL(decodeVarint(std::begin(truncated), std::end(truncated), decoded));
+}
+
+void test_empty()
+{
+    const SmallLog log;
+    TEST_ASSERT_EQUAL_UINT(0, log.size());
+    TEST_ASSERT_FALSE(log.getBegin().has_value());
+    TEST_ASSERT_EQUAL_INT(0, log.getDuration(at(0s), at(1'000s)).count());
+}
+
+void test_window()
+{
+    SmallLog log;
+    log.append(at(100s), at(200s));
+    log.append(at(300s), at(350s));
+    log.append(at(400s), at(500s));
+
+    TEST_ASSERT_EQUAL_UINT(3, log.size());
+    TEST_ASSERT_EQUAL_INT(250, log.getDuration(at(0s), at(1'000s)).count());
+    TEST_ASSERT_EQUAL_INT(0, log.getDuration(at(200s), at(300s)).count());
+    TEST_ASSERT_EQUAL_INT(50 + 20, log.getDuration(at(150s), at(320s)).count());
+    TEST_ASSERT_EQUAL_INT(50, log.getDuration(at(450s), at(600s)).count());
+}
+
+void test_oldest_block_is_discarded()
+{
+    SmallLog log;
+    // each interval needs 2 bytes (pause and length < 128), thus 8 intervals fit into a block
+    for (int interval = 0; interval < 3 * 8; ++interval)
+    {
+        const auto begin = std::chrono::seconds(interval * 100);
+        log.append(at(begin), at(begin + 10s));
+    }
+    TEST_ASSERT_EQUAL_UINT(3 * 8, log.size());
+    TEST_ASSERT_EQUAL_INT(0, log.getBegin().value().time_since_epoch().count());
+
+    log.append(at(2'400s), at(2'410s));
+    TEST_ASSERT_EQUAL_UINT(2 * 8 + 1, log.size());
+    TEST_ASSERT_EQUAL_INT(800, log.getBegin().value().time_since_epoch().count());
+    TEST_ASSERT_EQUAL_INT(17 * 10, log.getDuration(at(0s), at(10'000s)).count());
+}
+
+void test_compact_encoding()
+{
+    // per day 16 intervals of 25 minutes with 5 minutes pause
+    // pause (300 s) and length (1500 s) need 2 bytes each: 4 bytes per interval
+    // thus a block of 64 bytes holds one day
+    IntervalLog<std::chrono::steady_clock, 64, 2> log;
+    for (const auto day : {0h, 24h})
+    {
+        for (int interval = 0; interval < 16; ++interval)
+        {
+            const auto begin = day + 8h + interval * 30min;
+            log.append(at(begin), at(begin + 25min));
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT(32, log.size());
+    TEST_ASSERT_EQUAL_INT(8 * 3'600, log.getBegin().value().time_since_epoch().count());
+    TEST_ASSERT_EQUAL_INT(16 * 25 * 60, log.getDuration(at(24h), at(48h)).count());
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_varint_round_trip);
+    RUN_TEST(test_empty);
+    RUN_TEST(test_window);
+    RUN_TEST(test_oldest_block_is_discarded);
+    RUN_TEST(test_compact_encoding);
+
+    return UNITY_END();
+}
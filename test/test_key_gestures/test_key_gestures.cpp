@@ -0,0 +1,151 @@
+#include <chrono>
+#include <unity.h>
+#include <user_interaction/GestureDetector.hpp>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+typedef GestureDetector::Clock Clock;
+
+static std::vector<KeyGesture> gestures;
+static const Clock::time_point start{};
+
+static void record(const KeyGesture &gesture)
+{
+    gestures.push_back(gesture);
+}
+
+static KeyEvent press(const KeyId id, const Clock::duration at)
+{
+    return {.id = id, .isPressed = true, .timestamp = start + at};
+}
+
+static KeyEvent release(const KeyId id, const Clock::duration at)
+{
+    return {.id = id, .isPressed = false, .timestamp = start + at};
+}
+
+void setUp()
+{
+    gestures.clear();
+}
+
+void tearDown()
+{
+}
+
+void test_short_press()
+{
+    GestureDetector detector(record);
+    detector.handle(press(KeyId::TASK1, 10ms));
+    detector.poll(start + 500ms);
+    TEST_ASSERT_TRUE(gestures.empty()); // recognized when released
+    detector.handle(release(KeyId::TASK1, 300ms));
+    TEST_ASSERT_EQUAL_UINT(1, gestures.size());
+    TEST_ASSERT_TRUE(gestures.at(0).type == KeyGesture::Type::SHORT_PRESS);
+    TEST_ASSERT_TRUE(gestures.at(0).key == KeyId::TASK1);
+    TEST_ASSERT_TRUE(gestures.at(0).timestamp == start + 10ms);
+}
+
+void test_long_press_and_repeat()
+{
+    const auto &configuration = GestureDetector::defaultConfiguration;
+    GestureDetector detector(record);
+    detector.handle(press(KeyId::RIGHT, 0ms));
+    detector.poll(start + configuration.longPressTime - 1ms);
+    TEST_ASSERT_TRUE(gestures.empty());
+    detector.poll(start + configuration.longPressTime);
+    TEST_ASSERT_EQUAL_UINT(1, gestures.size());
+    TEST_ASSERT_TRUE(gestures.at(0).type == KeyGesture::Type::LONG_PRESS);
+    TEST_ASSERT_TRUE(gestures.at(0).timestamp == start); // when the key has been pressed
+
+    detector.poll(start + configuration.longPressTime + configuration.repeatInterval);
+    detector.poll(start + configuration.longPressTime + 2 * configuration.repeatInterval);
+    TEST_ASSERT_EQUAL_UINT(3, gestures.size());
+    TEST_ASSERT_TRUE(gestures.at(1).type == KeyGesture::Type::REPEAT);
+    TEST_ASSERT_TRUE(gestures.at(2).type == KeyGesture::Type::REPEAT);
+
+    // no short press after a long press
+    detector.handle(release(KeyId::RIGHT, configuration.longPressTime + 2 * configuration.repeatInterval + 1ms));
+    detector.poll(start + 10s);
+    TEST_ASSERT_EQUAL_UINT(3, gestures.size());
+}
+
+void test_next_deadline()
+{
+    const auto &configuration = GestureDetector::defaultConfiguration;
+    GestureDetector detector(record);
+    TEST_ASSERT_FALSE(detector.getNextDeadline().has_value());
+
+    detector.handle(press(KeyId::TASK2, 10ms));
+    TEST_ASSERT_TRUE(detector.getNextDeadline() == start + 10ms + configuration.longPressTime);
+    detector.poll(*detector.getNextDeadline());
+    TEST_ASSERT_EQUAL_UINT(1, gestures.size());
+    TEST_ASSERT_TRUE(detector.getNextDeadline() == start + 10ms + configuration.longPressTime + configuration.repeatInterval);
+
+    detector.handle(release(KeyId::TASK2, 900ms));
+    detector.poll(start + 10s);
+    TEST_ASSERT_FALSE(detector.getNextDeadline().has_value());
+}
+
+void test_long_press_recognized_when_released()
+{
+    // the events are processed late, no poll in between
+    GestureDetector detector(record);
+    detector.handle(press(KeyId::TASK2, 0ms));
+    detector.handle(release(KeyId::TASK2, 2s));
+    TEST_ASSERT_EQUAL_UINT(1, gestures.size());
+    TEST_ASSERT_TRUE(gestures.at(0).type == KeyGesture::Type::LONG_PRESS);
+    TEST_ASSERT_TRUE(gestures.at(0).timestamp == start);
+}
+
+void test_chord()
+{
+    GestureDetector detector(record);
+    detector.handle(press(KeyId::TASK1, 0ms));
+    detector.handle(press(KeyId::TASK4, 50ms));
+    detector.poll(start + 5s); // no long press of chord keys
+    detector.handle(release(KeyId::TASK1, 5s));
+    detector.handle(release(KeyId::TASK4, 5s));
+    TEST_ASSERT_EQUAL_UINT(1, gestures.size());
+    TEST_ASSERT_TRUE(gestures.at(0).type == KeyGesture::Type::CHORD);
+    TEST_ASSERT_TRUE(gestures.at(0).key == KeyId::TASK1);
+    TEST_ASSERT_TRUE(gestures.at(0).otherKey == KeyId::TASK4);
+}
+
+void test_keys_outside_of_chord_window_are_independent()
+{
+    GestureDetector detector(record);
+    detector.handle(press(KeyId::TASK1, 0ms));
+    detector.handle(press(KeyId::TASK4, 300ms));
+    detector.handle(release(KeyId::TASK4, 400ms));
+    detector.handle(release(KeyId::TASK1, 500ms));
+    TEST_ASSERT_EQUAL_UINT(2, gestures.size());
+    TEST_ASSERT_TRUE(gestures.at(0).type == KeyGesture::Type::SHORT_PRESS);
+    TEST_ASSERT_TRUE(gestures.at(0).key == KeyId::TASK4);
+    TEST_ASSERT_TRUE(gestures.at(1).type == KeyGesture::Type::SHORT_PRESS);
+    TEST_ASSERT_TRUE(gestures.at(1).key == KeyId::TASK1);
+}
+
+void test_release_without_press_is_ignored()
+{
+    GestureDetector detector(record);
+    detector.handle(release(KeyId::ENTER, 0ms));
+    detector.poll(start + 10s);
+    TEST_ASSERT_TRUE(gestures.empty());
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_short_press);
+    RUN_TEST(test_long_press_and_repeat);
+    RUN_TEST(test_next_deadline);
+    RUN_TEST(test_long_press_recognized_when_released);
+    RUN_TEST(test_chord);
+    RUN_TEST(test_keys_outside_of_chord_window_are_independent);
+    RUN_TEST(test_release_without_press_is_ignored);
+
+    return UNITY_END();
+}
@@ -0,0 +1,64 @@
+#include <chrono>
+#include <load_meter.hpp>
+#include <sstream>
+#include <string>
+#include <unity.h>
+
+using namespace std::chrono_literals;
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_load_is_evaluated_per_window()
+{
+    static LoadMeter meter("test"); // meters cannot unregister
+    const auto start = LoadMeter::Clock::now();
+    TEST_ASSERT_EQUAL_UINT(0, meter.getPercentage());
+
+    // busy for 250 ms of each 1000 ms
+    for (auto now = start; now < start + LoadMeter::window; now += 100ms)
+    {
+        meter.startWaiting(now + 25ms);
+        meter.stopWaiting(now + 100ms);
+    }
+    TEST_ASSERT_UINT_WITHIN(1, 25, meter.getPercentage());
+
+    // fully busy in the next window
+    meter.startWaiting(start + 2 * LoadMeter::window + 1ms);
+    TEST_ASSERT_UINT_WITHIN(1, 100, meter.getPercentage());
+}
+
+void test_idle_task_has_no_load()
+{
+    static LoadMeter meter("idle");
+    const auto start = LoadMeter::Clock::now();
+    meter.startWaiting(start);
+    meter.stopWaiting(start + 2 * LoadMeter::window);
+    TEST_ASSERT_EQUAL_UINT(0, meter.getPercentage());
+}
+
+void test_all_meters_are_printed()
+{
+    static LoadMeter first("first task", 0);
+    static LoadMeter second("second task");
+    std::ostringstream output;
+    LoadMeter::printAll(output);
+    TEST_ASSERT_TRUE(output.str().find("load of task first task on core 0: 0 %") != std::string::npos);
+    TEST_ASSERT_TRUE(output.str().find("load of task second task: 0 %") != std::string::npos);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_load_is_evaluated_per_window);
+    RUN_TEST(test_idle_task_has_no_load);
+    RUN_TEST(test_all_meters_are_printed);
+
+    return UNITY_END();
+}
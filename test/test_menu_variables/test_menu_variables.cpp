@@ -0,0 +1,94 @@
+#include <thread>
+#include <unity.h>
+#include <user_interaction/MenuItem.hpp>
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_switch_is_written_by_owner_only()
+{
+    static unsigned int notifications;
+    notifications = 0;
+    bool variable = false;
+    MenuItemSwitch item("Switch", &variable);
+    item.setRequestNotification([]() { notifications++; });
+    const MenuItemSwitch &shownItem = item;
+    TEST_ASSERT_TRUE(shownItem.hasVariable());
+    TEST_ASSERT_FALSE(shownItem.getValue());
+
+    shownItem.requestValue(true);
+    TEST_ASSERT_EQUAL_UINT(1, notifications);
+    TEST_ASSERT_TRUE(shownItem.getValue()); // shown before it is written
+    TEST_ASSERT_FALSE(variable);
+    item.synchronize();
+    TEST_ASSERT_TRUE(variable);
+
+    // changes of the owner are shown
+    variable = false;
+    item.synchronize();
+    TEST_ASSERT_FALSE(shownItem.getValue());
+}
+
+void test_value_is_rounded_to_decimals()
+{
+    double variable = 12.5;
+    MenuItemValue item("Value", &variable, 1, 0.0, 100.0);
+    const MenuItemValue &shownItem = item;
+    TEST_ASSERT_TRUE(shownItem.getValue() == 12.5);
+
+    shownItem.requestValue(3.0);
+    shownItem.requestValue(42.04); // the latest request wins
+    TEST_ASSERT_TRUE(variable == 12.5);
+    item.synchronize();
+    TEST_ASSERT_TRUE(variable == 42.0);
+
+    variable = 7.25;
+    item.synchronize();
+    TEST_ASSERT_TRUE(shownItem.getValue() == 7.3);
+    TEST_ASSERT_TRUE(variable == 7.25);
+}
+
+void test_item_without_variable()
+{
+    MenuItemValue item("Value", nullptr, 2, 0.0, 1.0);
+    TEST_ASSERT_FALSE(item.hasVariable());
+    item.requestValue(0.5);
+    item.synchronize(); // nothing to write
+}
+
+void test_concurrent_requests()
+{
+    bool switchVariable = false;
+    MenuItemSwitch item("Switch", &switchVariable);
+    constexpr int numberOfRequests = 100000;
+    std::thread gui([&item]() {
+        for (int request = 0; request < numberOfRequests; ++request)
+        {
+            item.requestValue(request % 2 == 0);
+        }
+        item.requestValue(true);
+    });
+    for (int synchronization = 0; synchronization < numberOfRequests; ++synchronization)
+    {
+        item.synchronize();
+    }
+    gui.join();
+    item.synchronize();
+    TEST_ASSERT_TRUE(switchVariable); // the latest request has been applied
+    TEST_ASSERT_TRUE(item.getValue());
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_switch_is_written_by_owner_only);
+    RUN_TEST(test_value_is_rounded_to_decimals);
+    RUN_TEST(test_item_without_variable);
+    RUN_TEST(test_concurrent_requests);
+    return UNITY_END();
+}
@@ -0,0 +1,160 @@
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <mpsc_queue.hpp>
+#include <tasks/Task.hpp>
+#include <thread>
+#include <unity.h>
+#include <vector>
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_fifo()
+{
+    MpscQueue<int, 4> queue;
+    TEST_ASSERT_FALSE(queue.pop().has_value());
+    for (int value = 1; value <= 4; ++value)
+    {
+        TEST_ASSERT_TRUE(queue.push(value));
+    }
+    TEST_ASSERT_FALSE(queue.push(5));
+    TEST_ASSERT_EQUAL_UINT(1, queue.getDroppedCount());
+
+    for (int value = 1; value <= 4; ++value)
+    {
+        TEST_ASSERT_EQUAL_INT(value, queue.pop().value());
+    }
+    TEST_ASSERT_FALSE(queue.pop().has_value());
+
+    // wrap around
+    TEST_ASSERT_TRUE(queue.push(6));
+    TEST_ASSERT_EQUAL_INT(6, queue.pop().value());
+}
+
+struct Message
+{
+    unsigned int producer;
+    unsigned int sequence;
+};
+
+void test_stress_multiple_producers()
+{
+    constexpr unsigned int numberOfProducers = 4;
+    constexpr unsigned int messagesPerProducer = 100'000;
+    MpscQueue<Message, 64> queue;
+
+    std::vector<std::thread> producers;
+    for (unsigned int producer = 0; producer < numberOfProducers; ++producer)
+    {
+        producers.emplace_back([&queue, producer]() {
+            for (unsigned int sequence = 0; sequence < messagesPerProducer; ++sequence)
+            {
+                while (!queue.push({.producer = producer, .sequence = sequence}))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::array<unsigned int, numberOfProducers> expectedSequence{};
+    unsigned int received = 0;
+    bool isOrdered = true;
+    while (received < numberOfProducers * messagesPerProducer)
+    {
+        if (const auto message = queue.pop())
+        {
+            isOrdered &= message->sequence == expectedSequence[message->producer];
+            expectedSequence[message->producer] = message->sequence + 1;
+            ++received;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    for (auto &producer : producers)
+    {
+        producer.join();
+    }
+
+    TEST_ASSERT_TRUE(isOrdered);
+    TEST_ASSERT_FALSE(queue.pop().has_value());
+    for (const auto sequence : expectedSequence)
+    {
+        TEST_ASSERT_EQUAL_UINT(messagesPerProducer, sequence);
+    }
+}
+
+void test_stress_task_store()
+{
+    // several contexts request to toggle tasks, only the owner modifies and reads the tasks
+    constexpr unsigned int numberOfProducers = 4;
+    constexpr unsigned int togglesPerProducer = 20'000; // even, so all tasks end up stopped
+    device::TaskCollection tasks;
+    for (TaskId id = 0; id < numberOfProducers; ++id)
+    {
+        tasks.try_emplace(id, "task");
+    }
+    MpscQueue<TaskId, 16> toggleRequests;
+    std::atomic<unsigned int> dropped{0};
+
+    std::vector<std::thread> producers;
+    for (TaskId producer = 0; producer < numberOfProducers; ++producer)
+    {
+        producers.emplace_back([&toggleRequests, &dropped, producer]() {
+            for (unsigned int toggle = 0; toggle < togglesPerProducer; ++toggle)
+            {
+                while (!toggleRequests.push(producer))
+                {
+                    dropped++;
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::array<unsigned int, numberOfProducers> toggles{};
+    unsigned int processed = 0;
+    while (processed < numberOfProducers * togglesPerProducer)
+    {
+        while (const auto id = toggleRequests.pop())
+        {
+            Task &task = tasks.at(*id);
+            task.isRunning() ? task.stop() : task.start();
+            ++toggles[*id];
+            ++processed;
+        }
+        // the owner may read while producers are busy
+        device::sampleRecordedDurations(tasks, [](TaskId, const Task &, Task::Duration) {});
+        std::this_thread::yield();
+    }
+    for (auto &producer : producers)
+    {
+        producer.join();
+    }
+
+    TEST_ASSERT_EQUAL_UINT(dropped.load(), toggleRequests.getDroppedCount());
+    for (const auto &[id, task] : tasks)
+    {
+        TEST_ASSERT_EQUAL_UINT(togglesPerProducer, toggles[id]);
+        TEST_ASSERT_FALSE(task.isRunning());
+    }
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_fifo);
+    RUN_TEST(test_stress_multiple_producers);
+    RUN_TEST(test_stress_task_store);
+
+    return UNITY_END();
+}
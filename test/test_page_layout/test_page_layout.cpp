@@ -0,0 +1,183 @@
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <display_interface/page_layout.hpp>
+#include <display_interface/pbm.hpp>
+#include <sstream>
+#include <string>
+#include <unity.h>
+#include <vector>
+
+using namespace page_layout;
+
+constexpr Coordinate displayWidth = 128;
+constexpr Coordinate displayHeight = 64;
+typedef std::array<std::uint8_t, displayWidth * displayHeight / pageHeight> Framebuffer;
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+/**
+ * Converts one pixel per byte into the frame buffer, as done before rendering into the page layout.
+ */
+static void drawPixels(Framebuffer &framebuffer, const Area &area, const std::uint8_t *pixels)
+{
+    for (Coordinate y = area.y1; y <= area.y2; ++y)
+    {
+        for (Coordinate x = area.x1; x <= area.x2; ++x)
+        {
+            if ((x >= 0) && (x < displayWidth) && (y >= 0) && (y < displayHeight))
+            {
+                setPixel(framebuffer.data(), displayWidth, x, y, *pixels);
+            }
+            ++pixels;
+        }
+    }
+}
+
+/**
+ * Renders a test pattern in both layouts.
+ */
+static void render(const Area &area, std::vector<std::uint8_t> &pixels, std::vector<std::uint8_t> &pages)
+{
+    const auto height = area.y2 - area.y1 + 1;
+    pixels.assign(area.getWidth() * height, 0);
+    pages.assign(area.getWidth() * height / pageHeight, 0);
+    for (Coordinate y = 0; y < height; ++y)
+    {
+        for (Coordinate x = 0; x < area.getWidth(); ++x)
+        {
+            const bool isOn = ((x * 7 + y * 3) % 5) == 0;
+            pixels.at(y * area.getWidth() + x) = isOn;
+            setPixel(pages.data(), area.getWidth(), x, y, isOn);
+        }
+    }
+}
+
+void test_round_to_pages()
+{
+    Area area{.x1 = 3, .y1 = 9, .x2 = 20, .y2 = 17};
+    roundToPages(area);
+    TEST_ASSERT_EQUAL_INT16(3, area.x1);
+    TEST_ASSERT_EQUAL_INT16(8, area.y1);
+    TEST_ASSERT_EQUAL_INT16(20, area.x2);
+    TEST_ASSERT_EQUAL_INT16(23, area.y2);
+
+    roundToPages(area); // already aligned
+    TEST_ASSERT_EQUAL_INT16(8, area.y1);
+    TEST_ASSERT_EQUAL_INT16(23, area.y2);
+}
+
+void test_set_pixel()
+{
+    std::array<std::uint8_t, 2 * 4> pages{};
+    setPixel(pages.data(), 4, 1, 0, true);
+    setPixel(pages.data(), 4, 2, 9, true);
+    setPixel(pages.data(), 4, 3, 15, true);
+    TEST_ASSERT_EQUAL_HEX8(0x01, pages.at(1));
+    TEST_ASSERT_EQUAL_HEX8(0x02, pages.at(4 + 2));
+    TEST_ASSERT_EQUAL_HEX8(0x80, pages.at(4 + 3));
+    setPixel(pages.data(), 4, 3, 15, false);
+    TEST_ASSERT_EQUAL_HEX8(0x00, pages.at(4 + 3));
+    TEST_ASSERT_TRUE(getPixel(pages.data(), 4, 2, 9));
+    TEST_ASSERT_FALSE(getPixel(pages.data(), 4, 2, 8));
+}
+
+void test_write_pbm()
+{
+    // 10 columns need 2 bytes per row
+    std::array<std::uint8_t, 2 * 10> pages{};
+    setPixel(pages.data(), 10, 0, 0, true);
+    setPixel(pages.data(), 10, 9, 0, true);
+    setPixel(pages.data(), 10, 3, 15, true);
+    std::ostringstream output;
+    writePbm(output, pages.data(), 10, 16);
+
+    const std::string header = "P4\n10 16\n";
+    const std::string image = output.str();
+    TEST_ASSERT_EQUAL_UINT(header.size() + 16 * 2, image.size());
+    TEST_ASSERT_EQUAL_STRING(header.c_str(), image.substr(0, header.size()).c_str());
+    const auto row = [&image, &header](const std::size_t y, const std::size_t byte) { return static_cast<std::uint8_t>(image.at(header.size() + y * 2 + byte)); };
+    TEST_ASSERT_EQUAL_HEX8(0x80, row(0, 0));
+    TEST_ASSERT_EQUAL_HEX8(0x40, row(0, 1));
+    TEST_ASSERT_EQUAL_HEX8(0x00, row(1, 0));
+    TEST_ASSERT_EQUAL_HEX8(0x10, row(15, 0));
+    TEST_ASSERT_EQUAL_HEX8(0x00, row(15, 1));
+}
+
+void test_copy_equals_pixel_conversion()
+{
+    const std::array<Area, 3> areas = {
+        Area{.x1 = 0, .y1 = 0, .x2 = displayWidth - 1, .y2 = displayHeight - 1},
+        Area{.x1 = 0, .y1 = 16, .x2 = displayWidth - 1, .y2 = 31},
+        Area{.x1 = 37, .y1 = 8, .x2 = 76, .y2 = 23},
+    };
+    for (const auto &area : areas)
+    {
+        std::vector<std::uint8_t> pixels;
+        std::vector<std::uint8_t> pages;
+        render(area, pixels, pages);
+        Framebuffer expected{};
+        Framebuffer actual{};
+        drawPixels(expected, area, pixels.data());
+        copyPages(actual.data(), displayWidth, area, pages.data());
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(expected.data(), actual.data(), expected.size());
+    }
+}
+
+/**
+ * Compares the duration of flushing a rendered area.
+ */
+void test_benchmark_flush()
+{
+    typedef std::chrono::steady_clock Clock;
+    constexpr unsigned int repetitions = 1'000;
+    const std::array<std::pair<const char *, Area>, 3> areas = {{
+        {"full frame", Area{.x1 = 0, .y1 = 0, .x2 = displayWidth - 1, .y2 = displayHeight - 1}},
+        {"full width band", Area{.x1 = 0, .y1 = 16, .x2 = displayWidth - 1, .y2 = 31}},
+        {"partial band", Area{.x1 = 37, .y1 = 8, .x2 = 76, .y2 = 23}},
+    }};
+    for (const auto &[name, area] : areas)
+    {
+        std::vector<std::uint8_t> pixels;
+        std::vector<std::uint8_t> pages;
+        render(area, pixels, pages);
+        Framebuffer framebuffer{};
+
+        const auto beginOfPixels = Clock::now();
+        for (unsigned int repetition = 0; repetition < repetitions; ++repetition)
+        {
+            drawPixels(framebuffer, area, pixels.data());
+        }
+        const auto beginOfPages = Clock::now();
+        for (unsigned int repetition = 0; repetition < repetitions; ++repetition)
+        {
+            copyPages(framebuffer.data(), displayWidth, area, pages.data());
+        }
+        const auto end = Clock::now();
+
+        const auto pixelTime = std::chrono::duration_cast<std::chrono::nanoseconds>(beginOfPages - beginOfPixels) / repetitions;
+        const auto pageTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - beginOfPages) / repetitions;
+        const std::string message = std::string(name) + ": per pixel " + std::to_string(pixelTime.count()) + " ns, per page " + std::to_string(pageTime.count()) + " ns";
+        TEST_MESSAGE(message.c_str());
+        TEST_ASSERT_TRUE(pageTime < pixelTime);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_round_to_pages);
+    RUN_TEST(test_set_pixel);
+    RUN_TEST(test_write_pbm);
+    RUN_TEST(test_copy_equals_pixel_conversion);
+    RUN_TEST(test_benchmark_flush);
+
+    return UNITY_END();
+}
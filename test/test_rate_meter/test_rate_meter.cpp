@@ -0,0 +1,52 @@
+#include <chrono>
+#include <rate_meter.hpp>
+#include <sstream>
+#include <string>
+#include <unity.h>
+
+using namespace std::chrono_literals;
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_rate_is_evaluated_per_window()
+{
+    static RateMeter meter("test", "bytes"); // meters cannot unregister
+    const auto start = RateMeter::Clock::now();
+    for (auto now = start; now < start + RateMeter::window; now += 100ms)
+    {
+        meter.count(50, now);
+    }
+    TEST_ASSERT_EQUAL_UINT(0, meter.getRate()); // the window has not been closed yet
+    meter.count(0, start + RateMeter::window + 10ms);
+    TEST_ASSERT_UINT_WITHIN(10, 500, meter.getRate());
+    TEST_ASSERT_EQUAL_UINT64(500, meter.getTotal());
+
+    // idle
+    meter.count(0, start + 3 * RateMeter::window);
+    TEST_ASSERT_EQUAL_UINT(0, meter.getRate());
+}
+
+void test_all_meters_are_printed()
+{
+    static RateMeter meter("bus", "bytes");
+    meter.count(42, RateMeter::Clock::now());
+    std::ostringstream output;
+    RateMeter::printAll(output);
+    TEST_ASSERT_TRUE(output.str().find("bus: 0 bytes/s, 42 bytes in total") != std::string::npos);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_rate_is_evaluated_per_window);
+    RUN_TEST(test_all_meters_are_printed);
+
+    return UNITY_END();
+}
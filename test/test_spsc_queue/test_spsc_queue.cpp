@@ -0,0 +1,105 @@
+#include <cstddef>
+#include <spsc_queue.hpp>
+#include <thread>
+#include <unity.h>
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_fifo()
+{
+    SpscQueue<int, 4> queue;
+    TEST_ASSERT_NULL(queue.peek());
+    TEST_ASSERT_FALSE(queue.pop().has_value());
+    for (int value = 1; value <= 4; ++value)
+    {
+        TEST_ASSERT_TRUE(queue.push(value));
+    }
+    TEST_ASSERT_FALSE(queue.push(5));
+    TEST_ASSERT_FALSE(queue.push(6));
+    TEST_ASSERT_EQUAL_UINT(2, queue.getDroppedCount());
+
+    TEST_ASSERT_EQUAL_INT(1, *queue.peek());
+    for (int value = 1; value <= 4; ++value)
+    {
+        TEST_ASSERT_EQUAL_INT(value, queue.pop().value());
+    }
+    TEST_ASSERT_FALSE(queue.pop().has_value());
+
+    // wrap around
+    TEST_ASSERT_TRUE(queue.push(7));
+    TEST_ASSERT_EQUAL_INT(7, queue.pop().value());
+}
+
+void test_producer_consumer_threads()
+{
+    constexpr unsigned int numberOfEvents = 1'000'000;
+    SpscQueue<unsigned int, 16> queue;
+
+    std::thread producer([&queue]() {
+        for (unsigned int event = 0; event < numberOfEvents; ++event)
+        {
+            while (!queue.push(event))
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    unsigned int expected = 0;
+    bool isOrdered = true;
+    while (expected < numberOfEvents)
+    {
+        if (const auto event = queue.pop())
+        {
+            isOrdered &= *event == expected;
+            ++expected;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    TEST_ASSERT_TRUE(isOrdered);
+    TEST_ASSERT_FALSE(queue.pop().has_value());
+}
+
+void test_overflow_is_counted()
+{
+    // the consumer does not run while the producer pushes a burst
+    constexpr std::size_t burst = 100;
+    SpscQueue<unsigned int, 16> queue;
+    std::thread producer([&queue]() {
+        for (unsigned int event = 0; event < burst; ++event)
+        {
+            queue.push(event);
+        }
+    });
+    producer.join();
+
+    std::size_t received = 0;
+    while (queue.pop())
+    {
+        ++received;
+    }
+    TEST_ASSERT_EQUAL_UINT(queue.capacity(), received);
+    TEST_ASSERT_EQUAL_UINT(burst - queue.capacity(), queue.getDroppedCount());
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_fifo);
+    RUN_TEST(test_producer_consumer_threads);
+    RUN_TEST(test_overflow_is_counted);
+
+    return UNITY_END();
+}
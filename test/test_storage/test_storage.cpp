@@ -0,0 +1,465 @@
+#include <chrono>
+#include <filesystem>
+#include <persistent_storage/FileStorage.hpp>
+#include <storage/TaskJournal.hpp>
+#include <tasks/Task.hpp>
+#include <unity.h>
+
+static const std::filesystem::path directory = std::filesystem::temp_directory_path() / "task_tracker_test_storage";
+
+/**
+ * Never flushes or compacts on its own; the tests trigger it explicitly.
+ */
+static constexpr TaskJournal::Configuration manualConfiguration = {
+    .flushThreshold = TaskJournal::bufferSize,
+    .flushDelay = std::chrono::hours(1),
+    .compactionThreshold = SIZE_MAX,
+    .snapshotInterval = std::chrono::hours(1),
+};
+
+void setUp()
+{
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+}
+
+void tearDown()
+{
+    std::filesystem::remove_all(directory);
+}
+
+static device::TaskCollection restore()
+{
+    FileStorage storage(directory.string());
+    TaskJournal journal;
+    journal.attach(storage);
+    device::TaskCollection tasks;
+    journal.restore(tasks);
+    return tasks;
+}
+
+static std::uintmax_t getJournalSize()
+{
+    return std::filesystem::file_size(directory / "tasks.journal");
+}
+
+void test_empty_storage()
+{
+    const auto tasks = restore();
+    TEST_ASSERT_TRUE(tasks.empty());
+}
+
+void test_not_attached()
+{
+    TaskJournal journal;
+    device::TaskCollection tasks;
+    const auto &task = tasks.try_emplace(1, "foo").first->second;
+    journal.recordAdd(1, task);
+    journal.flush();
+    journal.compact(tasks);
+    TEST_ASSERT_FALSE(std::filesystem::exists(directory / "tasks.journal"));
+    TEST_ASSERT_FALSE(std::filesystem::exists(directory / "tasks.snapshot"));
+}
+
+void test_replay_journal()
+{
+    {
+        FileStorage storage(directory.string());
+        TaskJournal journal(manualConfiguration);
+        journal.attach(storage);
+        device::TaskCollection tasks;
+        journal.restore(tasks);
+
+        tasks.try_emplace(1, "first", std::chrono::seconds(10));
+        journal.recordAdd(1, tasks.at(1));
+        tasks.try_emplace(2, "zweiter Tästk", std::chrono::seconds(20));
+        journal.recordAdd(2, tasks.at(2));
+        tasks.try_emplace(3, "third");
+        journal.recordAdd(3, tasks.at(3));
+
+        auto &first = tasks.at(1);
+        first.setLabel("renamed");
+        first.setRecordedDuration(std::chrono::seconds(15));
+        journal.recordEdit(1, first);
+        tasks.erase(3);
+        journal.recordDelete(3);
+        tasks.at(2).start();
+        journal.recordStart(2);
+        journal.flush();
+    }
+
+    auto tasks = restore();
+    TEST_ASSERT_EQUAL_UINT(2, tasks.size());
+    TEST_ASSERT_EQUAL_STRING("renamed", tasks.at(1).getLabel().c_str());
+    TEST_ASSERT_EQUAL_INT(15, tasks.at(1).getRecordedDuration().count());
+    TEST_ASSERT_FALSE(tasks.at(1).isRunning());
+    TEST_ASSERT_EQUAL_STRING("zweiter Tästk", tasks.at(2).getLabel().c_str());
+    TEST_ASSERT_EQUAL_INT(20, tasks.at(2).getLastRecordedDuration().count());
+    TEST_ASSERT_TRUE(tasks.at(2).isRunning());
+    TEST_ASSERT_TRUE(tasks.find(3) == tasks.end());
+}
+
+void test_pending_records_are_not_written()
+{
+    FileStorage storage(directory.string());
+    TaskJournal journal(manualConfiguration);
+    journal.attach(storage);
+    device::TaskCollection tasks;
+    journal.restore(tasks);
+
+    auto &task = tasks.try_emplace(1, "foo").first->second;
+    journal.recordAdd(1, task);
+    task.start();
+    journal.recordStart(1);
+    journal.loop(tasks);
+    TEST_ASSERT_TRUE(restore().empty());
+
+    journal.flush();
+    TEST_ASSERT_EQUAL_UINT(1, restore().size());
+}
+
+void test_flush_threshold()
+{
+    FileStorage storage(directory.string());
+    TaskJournal journal({.flushThreshold = 16, .flushDelay = std::chrono::hours(1), .compactionThreshold = SIZE_MAX, .snapshotInterval = std::chrono::hours(1)});
+    journal.attach(storage);
+    device::TaskCollection tasks;
+    journal.restore(tasks);
+
+    auto &task = tasks.try_emplace(1, "a label which is long enough").first->second;
+    journal.recordAdd(1, task);
+    journal.loop(tasks);
+    TEST_ASSERT_EQUAL_UINT(1, restore().size());
+}
+
+void test_compaction()
+{
+    FileStorage storage(directory.string());
+    TaskJournal journal(manualConfiguration);
+    journal.attach(storage);
+    device::TaskCollection tasks;
+    journal.restore(tasks);
+
+    auto &task = tasks.try_emplace(7, "seven", std::chrono::seconds(700)).first->second;
+    journal.recordAdd(7, task);
+    for (int cycle = 0; cycle < 10; ++cycle)
+    {
+        task.start();
+        journal.recordStart(7);
+        task.stop();
+        journal.recordStop(7, task);
+    }
+    journal.flush();
+    TEST_ASSERT_GREATER_THAN(0, getJournalSize());
+
+    journal.compact(tasks);
+    TEST_ASSERT_EQUAL_UINT(0, getJournalSize());
+    TEST_ASSERT_FALSE(std::filesystem::exists(directory / "tasks.snapshot.tmp"));
+
+    const auto restored = restore();
+    TEST_ASSERT_EQUAL_UINT(1, restored.size());
+    TEST_ASSERT_EQUAL_STRING("seven", restored.at(7).getLabel().c_str());
+    TEST_ASSERT_EQUAL_INT(700, restored.at(7).getRecordedDuration().count());
+}
+
+void test_stale_journal_is_skipped()
+{
+    // simulates a power loss after writing the snapshot, but before clearing the journal
+    FileStorage storage(directory.string());
+    TaskJournal journal(manualConfiguration);
+    journal.attach(storage);
+    device::TaskCollection tasks;
+    journal.restore(tasks);
+
+    auto &task = tasks.try_emplace(1, "foo", std::chrono::seconds(3)).first->second;
+    journal.recordAdd(1, task);
+    task.setRecordedDuration(std::chrono::seconds(5));
+    journal.recordEdit(1, task);
+    task.start();
+    journal.recordStart(1);
+    task.stop();
+    journal.recordStop(1, task);
+    tasks.try_emplace(2, "bar");
+    journal.recordAdd(2, tasks.at(2));
+    tasks.erase(2);
+    journal.recordDelete(2);
+    journal.flush();
+    const auto journalContent = storage.readJournal();
+    tasks.at(1).setRecordedDuration(std::chrono::seconds(8));
+    journal.compact(tasks);
+    storage.appendJournal(journalContent.data(), journalContent.size());
+
+    const auto restored = restore();
+    TEST_ASSERT_EQUAL_UINT(1, restored.size());
+    TEST_ASSERT_EQUAL_INT(8, restored.at(1).getRecordedDuration().count()); // not set back by the records of the journal
+}
+
+void test_stale_journal_is_cleared()
+{
+    {
+        FileStorage storage(directory.string());
+        TaskJournal journal(manualConfiguration);
+        journal.attach(storage);
+        device::TaskCollection tasks;
+        journal.restore(tasks);
+        tasks.try_emplace(1, "foo");
+        journal.recordAdd(1, tasks.at(1));
+        journal.flush();
+        const auto journalContent = storage.readJournal();
+        journal.compact(tasks);
+        storage.appendJournal(journalContent.data(), journalContent.size());
+    }
+
+    // records must not be appended to the stale journal, as they would be skipped as well
+    FileStorage storage(directory.string());
+    TaskJournal journal(manualConfiguration);
+    journal.attach(storage);
+    device::TaskCollection tasks;
+    journal.restore(tasks);
+    tasks.try_emplace(2, "bar");
+    journal.recordAdd(2, tasks.at(2));
+    journal.loop(tasks);
+    journal.flush();
+    TEST_ASSERT_EQUAL_UINT(2, restore().size());
+
+    tasks.try_emplace(3, "baz");
+    journal.recordAdd(3, tasks.at(3));
+    journal.flush();
+    TEST_ASSERT_EQUAL_UINT(3, restore().size());
+}
+
+/**
+ * Storage whose snapshot cannot be replaced, e.g. because the file system is full.
+ */
+class ReadOnlySnapshotStorage : public FileStorage
+{
+  public:
+    using FileStorage::FileStorage;
+
+    bool writeSnapshot(const std::uint8_t *, std::size_t) override
+    {
+        return false;
+    }
+};
+
+void test_failed_snapshot_keeps_records()
+{
+    ReadOnlySnapshotStorage storage(directory.string());
+    TaskJournal journal(manualConfiguration);
+    journal.attach(storage);
+    device::TaskCollection tasks;
+    journal.restore(tasks);
+    tasks.try_emplace(1, "foo");
+    journal.recordAdd(1, tasks.at(1));
+    journal.flush();
+    tasks.try_emplace(2, "bar");
+    journal.recordAdd(2, tasks.at(2));
+    journal.compact(tasks);
+
+    tasks.try_emplace(3, "baz");
+    journal.recordAdd(3, tasks.at(3));
+    journal.flush();
+    TEST_ASSERT_EQUAL_UINT(3, restore().size());
+}
+
+/**
+ * Storage whose journal cannot be cleared after replacing the snapshot.
+ */
+class UnclearableJournalStorage : public FileStorage
+{
+  public:
+    using FileStorage::FileStorage;
+
+    bool writeSnapshot(const std::uint8_t *data, std::size_t size) override
+    {
+        const auto journal = readJournal();
+        const bool isWritten = FileStorage::writeSnapshot(data, size);
+        appendJournal(journal.data(), journal.size());
+        return isWritten;
+    }
+};
+
+void test_records_after_uncleared_journal_are_replayed()
+{
+    UnclearableJournalStorage storage(directory.string());
+    TaskJournal journal(manualConfiguration);
+    journal.attach(storage);
+    device::TaskCollection tasks;
+    journal.restore(tasks);
+    auto &task = tasks.try_emplace(1, "foo").first->second;
+    journal.recordAdd(1, task);
+    task.setRecordedDuration(std::chrono::seconds(5));
+    journal.recordEdit(1, task);
+    journal.flush();
+    task.setRecordedDuration(std::chrono::seconds(8));
+    journal.compact(tasks);
+
+    tasks.try_emplace(2, "bar");
+    journal.recordAdd(2, tasks.at(2));
+    journal.flush();
+    const auto restored = restore();
+    TEST_ASSERT_EQUAL_UINT(2, restored.size());
+    TEST_ASSERT_EQUAL_INT(8, restored.at(1).getRecordedDuration().count()); // not set back by the records of the journal
+}
+
+void test_bindings()
+{
+    TaskJournal::Bindings restoredBindings;
+    const auto restoreBindings = [&restoredBindings]() {
+        FileStorage storage(directory.string());
+        TaskJournal journal;
+        journal.attach(storage);
+        device::TaskCollection tasks;
+        journal.restore(tasks);
+        restoredBindings = journal.getBindings();
+    };
+    FileStorage storage(directory.string());
+    TaskJournal journal(manualConfiguration);
+    journal.attach(storage);
+    device::TaskCollection tasks;
+    journal.restore(tasks);
+    TEST_ASSERT_FALSE(journal.getBindings().at(0).has_value());
+
+    journal.recordBind(0, 31);
+    journal.recordBind(3, 7);
+    journal.recordBind(0, 42);
+    journal.recordBind(TaskJournal::numberOfBindings, 8); // not a task key
+    journal.flush();
+    restoreBindings();
+    TEST_ASSERT_EQUAL_UINT32(42, restoredBindings.at(0).value());
+    TEST_ASSERT_FALSE(restoredBindings.at(1).has_value());
+    TEST_ASSERT_EQUAL_UINT32(7, restoredBindings.at(3).value());
+
+    journal.compact(tasks);
+    journal.recordBind(1, 9);
+    journal.flush();
+    restoreBindings();
+    TEST_ASSERT_EQUAL_UINT32(42, restoredBindings.at(0).value());
+    TEST_ASSERT_EQUAL_UINT32(9, restoredBindings.at(1).value());
+    TEST_ASSERT_EQUAL_UINT32(7, restoredBindings.at(3).value());
+}
+
+void test_initialization()
+{
+    const auto isRestoredInitialized = []() {
+        FileStorage storage(directory.string());
+        TaskJournal journal;
+        journal.attach(storage);
+        device::TaskCollection tasks;
+        journal.restore(tasks);
+        return journal.isInitialized();
+    };
+    FileStorage storage(directory.string());
+    TaskJournal journal(manualConfiguration);
+    journal.attach(storage);
+    device::TaskCollection tasks;
+    journal.restore(tasks);
+    TEST_ASSERT_FALSE(journal.isInitialized());
+
+    journal.recordInitialization();
+    journal.flush();
+    TEST_ASSERT_TRUE(isRestoredInitialized());
+
+    // also without any tasks, which must not be provided again
+    journal.compact(tasks);
+    TEST_ASSERT_TRUE(isRestoredInitialized());
+}
+
+void test_incomplete_record_is_ignored()
+{
+    FileStorage storage(directory.string());
+    TaskJournal journal(manualConfiguration);
+    journal.attach(storage);
+    device::TaskCollection tasks;
+    journal.restore(tasks);
+
+    tasks.try_emplace(1, "complete");
+    journal.recordAdd(1, tasks.at(1));
+    journal.flush();
+    const auto sizeOfCompleteRecord = getJournalSize();
+    tasks.try_emplace(2, "incomplete");
+    journal.recordAdd(2, tasks.at(2));
+    journal.flush();
+    std::filesystem::resize_file(directory / "tasks.journal", getJournalSize() - 1);
+
+    auto restored = restore();
+    TEST_ASSERT_EQUAL_UINT(1, restored.size());
+    TEST_ASSERT_EQUAL_STRING("complete", restored.at(1).getLabel().c_str());
+
+    // corrupted instead of truncated
+    std::filesystem::resize_file(directory / "tasks.journal", sizeOfCompleteRecord);
+    const std::uint8_t garbage[] = {0x03, 0x01, 0x02, 0x03, 0x04, 0x05};
+    storage.appendJournal(garbage, sizeof(garbage));
+    restored = restore();
+    TEST_ASSERT_EQUAL_UINT(1, restored.size());
+}
+
+void test_incomplete_record_is_compacted()
+{
+    {
+        FileStorage storage(directory.string());
+        TaskJournal journal(manualConfiguration);
+        journal.attach(storage);
+        device::TaskCollection tasks;
+        journal.restore(tasks);
+        tasks.try_emplace(1, "foo");
+        journal.recordAdd(1, tasks.at(1));
+        journal.flush();
+    }
+    std::filesystem::resize_file(directory / "tasks.journal", getJournalSize() - 1);
+
+    FileStorage storage(directory.string());
+    TaskJournal journal(manualConfiguration);
+    journal.attach(storage);
+    device::TaskCollection tasks;
+    journal.restore(tasks);
+    journal.loop(tasks);
+    TEST_ASSERT_EQUAL_UINT(0, getJournalSize());
+
+    tasks.try_emplace(2, "bar");
+    journal.recordAdd(2, tasks.at(2));
+    journal.flush();
+    TEST_ASSERT_EQUAL_UINT(1, restore().size());
+}
+
+void test_full_buffer_schedules_snapshot()
+{
+    FileStorage storage(directory.string());
+    TaskJournal journal(manualConfiguration);
+    journal.attach(storage);
+    device::TaskCollection tasks;
+    journal.restore(tasks);
+
+    constexpr TaskId numberOfTasks = 100;
+    for (TaskId id = 0; id < numberOfTasks; ++id)
+    {
+        tasks.try_emplace(id, "task " + std::to_string(id));
+        journal.recordAdd(id, tasks.at(id));
+    }
+    journal.loop(tasks);
+    TEST_ASSERT_TRUE(std::filesystem::exists(directory / "tasks.snapshot"));
+    TEST_ASSERT_EQUAL_UINT(numberOfTasks, restore().size());
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_empty_storage);
+    RUN_TEST(test_not_attached);
+    RUN_TEST(test_replay_journal);
+    RUN_TEST(test_pending_records_are_not_written);
+    RUN_TEST(test_flush_threshold);
+    RUN_TEST(test_compaction);
+    RUN_TEST(test_stale_journal_is_skipped);
+    RUN_TEST(test_stale_journal_is_cleared);
+    RUN_TEST(test_failed_snapshot_keeps_records);
+    RUN_TEST(test_records_after_uncleared_journal_are_replayed);
+    RUN_TEST(test_bindings);
+    RUN_TEST(test_initialization);
+    RUN_TEST(test_incomplete_record_is_ignored);
+    RUN_TEST(test_incomplete_record_is_compacted);
+    RUN_TEST(test_full_buffer_schedules_snapshot);
+
+    return UNITY_END();
+}
@@ -0,0 +1,79 @@
+#include <cstddef>
+#include <stdexcept>
+#include <tasks/Task.hpp>
+#include <unity.h>
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_ordered_iteration()
+{
+    device::TaskCollection tasks;
+    TEST_ASSERT_TRUE(tasks.emplace(42, "c").second);
+    TEST_ASSERT_TRUE(tasks.emplace(7, "a").second);
+    TEST_ASSERT_TRUE(tasks.try_emplace(31, "b").second);
+    TEST_ASSERT_EQUAL_UINT(3, tasks.size());
+
+    const TaskId expectedOrder[] = {7, 31, 42};
+    std::size_t index = 0;
+    for (const auto &[id, task] : tasks)
+    {
+        TEST_ASSERT_EQUAL_UINT(expectedOrder[index++], id);
+    }
+    TEST_ASSERT_EQUAL_STRING("b", tasks.at(31).getLabel().c_str());
+}
+
+void test_no_duplicates()
+{
+    device::TaskCollection tasks;
+    TEST_ASSERT_TRUE(tasks.emplace(42, "hello mars").second);
+    const auto [element, created] = tasks.try_emplace(42, "hello venus");
+    TEST_ASSERT_FALSE(created);
+    TEST_ASSERT_EQUAL_UINT(42, element->first);
+    TEST_ASSERT_EQUAL_STRING("hello mars", element->second.getLabel().c_str());
+    TEST_ASSERT_EQUAL_UINT(1, tasks.size());
+}
+
+void test_lookup_and_erase()
+{
+    device::TaskCollection tasks;
+    tasks.emplace(1, "one");
+    tasks.emplace(2, "two");
+    tasks.emplace(3, "three");
+
+    TEST_ASSERT_TRUE(tasks.find(4) == tasks.end());
+    TEST_ASSERT_EQUAL_UINT(2, tasks.find(2)->first);
+    try
+    {
+        tasks.at(4);
+        TEST_FAIL_MESSAGE("exception has not been thrown for unknown id");
+    }
+    catch (const std::out_of_range &)
+    {
+    }
+
+    TEST_ASSERT_EQUAL_UINT(1, tasks.erase(2));
+    TEST_ASSERT_EQUAL_UINT(0, tasks.erase(2));
+    TEST_ASSERT_EQUAL_UINT(2, tasks.size());
+    TEST_ASSERT_TRUE(tasks.find(2) == tasks.end());
+    TEST_ASSERT_EQUAL_STRING("three", tasks.at(3).getLabel().c_str());
+
+    tasks.clear();
+    TEST_ASSERT_TRUE(tasks.empty());
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_ordered_iteration);
+    RUN_TEST(test_no_duplicates);
+    RUN_TEST(test_lookup_and_erase);
+
+    return UNITY_END();
+}
@@ -0,0 +1,102 @@
+#include "../helpers/counting_new.hpp"
+#include "../helpers/create_tasks.hpp"
+#include <cstddef>
+#include <string>
+#include <tasks/Task.hpp>
+#include <unity.h>
+#include <user_interaction/TaskDashboard.hpp>
+
+using namespace std::chrono_literals;
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_nothing_is_delivered_unless_requested()
+{
+    device::TaskCollection tasks;
+    createTasks(tasks, 3);
+    tasks.at(1).start();
+    TaskDashboard dashboard;
+    dashboard.update(tasks);
+    TEST_ASSERT_FALSE(dashboard.takeSnapshot().has_value());
+}
+
+void test_running_tasks_are_delivered_once_per_request()
+{
+    device::TaskCollection tasks;
+    createTasks(tasks, 10);
+    tasks.at(3).setRecordedDuration(90s);
+    tasks.at(3).start();
+    tasks.at(7).start();
+    TaskDashboard dashboard;
+    std::size_t notifications = 0;
+    dashboard.setRequestNotification([&notifications]() { ++notifications; });
+
+    dashboard.request();
+    TEST_ASSERT_EQUAL_UINT(1, notifications);
+    const auto before = Task::Clock::now();
+    dashboard.update(tasks);
+    const auto after = Task::Clock::now();
+    const auto snapshot = dashboard.takeSnapshot();
+    TEST_ASSERT_TRUE(snapshot.has_value());
+    TEST_ASSERT_TRUE(before <= snapshot->sampledAt && snapshot->sampledAt <= after);
+    TEST_ASSERT_EQUAL_UINT(2, snapshot->numberOfRunningTasks);
+    TEST_ASSERT_EQUAL_UINT(2, snapshot->numberOfRows);
+    TEST_ASSERT_EQUAL_UINT(3, snapshot->rows[0].id);
+    TEST_ASSERT_EQUAL_STRING("Task 3", snapshot->rows[0].label.c_str());
+    TEST_ASSERT_EQUAL_INT(90, snapshot->rows[0].duration.count());
+    TEST_ASSERT_EQUAL_UINT(7, snapshot->rows[1].id);
+
+    dashboard.update(tasks);
+    TEST_ASSERT_FALSE(dashboard.takeSnapshot().has_value());
+}
+
+void test_rows_are_limited()
+{
+    device::TaskCollection tasks;
+    createTasks(tasks, 10);
+    for (auto &[id, task] : tasks)
+    {
+        task.start();
+    }
+    TaskDashboard dashboard;
+    dashboard.request();
+    dashboard.update(tasks);
+    const auto snapshot = dashboard.takeSnapshot();
+    TEST_ASSERT_EQUAL_UINT(10, snapshot->numberOfRunningTasks);
+    TEST_ASSERT_EQUAL_UINT(TaskDashboard::maximumRows, snapshot->numberOfRows);
+    TEST_ASSERT_EQUAL_UINT(TaskDashboard::maximumRows - 1, snapshot->rows[TaskDashboard::maximumRows - 1].id);
+}
+
+void test_update_does_not_allocate()
+{
+    device::TaskCollection tasks;
+    createTasks(tasks, 5'000);
+    tasks.at(4'999).start();
+    TaskDashboard dashboard;
+    numberOfAllocations = 0;
+    for (int second = 0; second < 10; ++second)
+    {
+        dashboard.request();
+        dashboard.update(tasks);
+        TEST_ASSERT_EQUAL_UINT(1, dashboard.takeSnapshot()->numberOfRows);
+    }
+    TEST_ASSERT_EQUAL_UINT(0, numberOfAllocations);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_nothing_is_delivered_unless_requested);
+    RUN_TEST(test_running_tasks_are_delivered_once_per_request);
+    RUN_TEST(test_rows_are_limited);
+    RUN_TEST(test_update_does_not_allocate);
+
+    return UNITY_END();
+}
@@ -0,0 +1,79 @@
+#include <tasks/Task.hpp>
+#include <unity.h>
+#include <user_interaction/TaskKeyBindings.hpp>
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_unbound_key()
+{
+    device::TaskCollection tasks;
+    tasks.emplace(31, "Task 1");
+    TaskKeyBindings bindings(tasks);
+    TEST_ASSERT_NULL(bindings.getTask(KeyId::TASK1));
+    TEST_ASSERT_FALSE(bindings.getTaskId(KeyId::TASK1).has_value());
+}
+
+void test_only_task_keys_can_be_bound()
+{
+    device::TaskCollection tasks;
+    TaskKeyBindings bindings(tasks);
+    TEST_ASSERT_TRUE(bindings.bind(KeyId::TASK4, 31));
+    TEST_ASSERT_FALSE(bindings.bind(KeyId::ENTER, 31));
+    TEST_ASSERT_NULL(bindings.getTask(KeyId::ENTER));
+}
+
+void test_binding_survives_add_and_delete()
+{
+    device::TaskCollection tasks;
+    tasks.emplace(31, "Task 1");
+    tasks.emplace(32, "Task 2");
+    TaskKeyBindings bindings(tasks);
+    TEST_ASSERT_TRUE(bindings.bind(KeyId::TASK1, 32));
+    TEST_ASSERT_EQUAL_STRING("Task 2", bindings.getTask(KeyId::TASK1)->getLabel().c_str());
+
+    // adding a task with a lower ID must not rebind the key
+    tasks.emplace(7, "Task 0");
+    TEST_ASSERT_EQUAL_STRING("Task 2", bindings.getTask(KeyId::TASK1)->getLabel().c_str());
+
+    // deleting another task must not rebind the key
+    tasks.erase(31);
+    TEST_ASSERT_EQUAL_STRING("Task 2", bindings.getTask(KeyId::TASK1)->getLabel().c_str());
+
+    // deleting the bound task leaves the key without task
+    tasks.erase(32);
+    TEST_ASSERT_NULL(bindings.getTask(KeyId::TASK1));
+    TEST_ASSERT_EQUAL_UINT(32, bindings.getTaskId(KeyId::TASK1).value());
+
+    // the binding applies again as soon as the task is re-created
+    tasks.emplace(32, "Task 2 again");
+    TEST_ASSERT_EQUAL_STRING("Task 2 again", bindings.getTask(KeyId::TASK1)->getLabel().c_str());
+}
+
+void test_revision_changes_when_bound()
+{
+    device::TaskCollection tasks;
+    TaskKeyBindings bindings(tasks);
+    const auto revision = bindings.getRevision();
+    bindings.bind(KeyId::ENTER, 31);
+    TEST_ASSERT_EQUAL_UINT(revision, bindings.getRevision());
+    bindings.bind(KeyId::TASK2, 31);
+    TEST_ASSERT_TRUE(revision != bindings.getRevision());
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_unbound_key);
+    RUN_TEST(test_only_task_keys_can_be_bound);
+    RUN_TEST(test_binding_survives_add_and_delete);
+    RUN_TEST(test_revision_changes_when_bound);
+
+    return UNITY_END();
+}
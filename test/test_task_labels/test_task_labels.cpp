@@ -0,0 +1,113 @@
+#include "../helpers/counting_new.hpp"
+#include <cstddef>
+#include <inline_string.hpp>
+#include <serial_protocol/TaskObject.hpp>
+#include <string>
+#include <string_view>
+#include <tasks/Task.hpp>
+#include <unity.h>
+
+/**
+ * Too long for the small string optimization of `std::string`.
+ */
+static constexpr std::string_view longLabel = "a label beyond any small string buffer";
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_assign()
+{
+    const InlineString<8> empty;
+    TEST_ASSERT_TRUE(empty.empty());
+    TEST_ASSERT_EQUAL_STRING("", empty.c_str());
+
+    const InlineString<8> fromLiteral = "foo";
+    TEST_ASSERT_EQUAL_UINT(3, fromLiteral.size());
+    TEST_ASSERT_EQUAL_STRING("foo", fromLiteral.c_str());
+
+    const std::string text("bar");
+    InlineString<8> fromString = text;
+    TEST_ASSERT_TRUE(fromString == "bar");
+    fromString.assign(std::string_view("12345678"));
+    TEST_ASSERT_EQUAL_STRING("12345678", fromString.c_str());
+}
+
+void test_truncate()
+{
+    const InlineString<4> truncated = "123456";
+    TEST_ASSERT_EQUAL_UINT(4, truncated.size());
+    TEST_ASSERT_EQUAL_STRING("1234", truncated.c_str());
+}
+
+void test_truncate_utf8()
+{
+    // "ä" needs 2 bytes, "€" needs 3 bytes
+    const InlineString<4> twoByte = "aää";
+    TEST_ASSERT_EQUAL_STRING("aä", twoByte.c_str());
+    const InlineString<4> threeByte = "ä€";
+    TEST_ASSERT_EQUAL_STRING("ä", threeByte.c_str());
+    const InlineString<5> exactFit = "ä€";
+    TEST_ASSERT_EQUAL_STRING("ä€", exactFit.c_str());
+}
+
+void test_task_label_is_truncated()
+{
+    const std::string longLabel(Task::String::capacity() + 10, 'x');
+    const Task task(longLabel);
+    TEST_ASSERT_EQUAL_UINT(Task::String::capacity(), task.getLabel().size());
+}
+
+/**
+ * Creating, editing and listing the tasks in the collection does not allocate per task.
+ *
+ * This covers the tasks and the borrowed labels of the protocol objects only.
+ * The protocol handlers still allocate to parse the command line and to generate the JSON output.
+ */
+void test_task_store_does_not_allocate()
+{
+    constexpr TaskId numberOfTasks = 100;
+    device::TaskCollection tasks;
+    tasks.reserve(numberOfTasks);
+    numberOfAllocations = 0;
+
+    // create
+    for (TaskId id = 0; id < numberOfTasks; ++id)
+    {
+        tasks.try_emplace(id, longLabel);
+    }
+    TEST_ASSERT_EQUAL_UINT(0, numberOfAllocations);
+
+    // edit
+    for (auto &[id, task] : tasks)
+    {
+        task.setLabel(longLabel.substr(2));
+    }
+    TEST_ASSERT_EQUAL_UINT(0, numberOfAllocations);
+
+    // list
+    std::size_t totalLength = 0;
+    device::sampleRecordedDurations(tasks, [&totalLength](const TaskId id, const Task &task, const Task::Duration duration) {
+        const task_tracker_systems::TaskObject object = {.id = id, .label = task.getLabel(), .duration = duration.count()};
+        totalLength += object.label.size();
+    });
+    TEST_ASSERT_EQUAL_UINT(0, numberOfAllocations);
+    TEST_ASSERT_EQUAL_UINT(numberOfTasks * longLabel.substr(2).size(), totalLength);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_assign);
+    RUN_TEST(test_truncate);
+    RUN_TEST(test_truncate_utf8);
+    RUN_TEST(test_task_label_is_truncated);
+    RUN_TEST(test_task_store_does_not_allocate);
+
+    return UNITY_END();
+}
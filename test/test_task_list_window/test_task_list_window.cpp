@@ -0,0 +1,155 @@
+#include "../helpers/counting_new.hpp"
+#include "../helpers/create_tasks.hpp"
+#include <cstddef>
+#include <string>
+#include <tasks/Task.hpp>
+#include <unity.h>
+#include <user_interaction/TaskListWindow.hpp>
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_nothing_is_delivered_unless_requested()
+{
+    device::TaskCollection tasks;
+    createTasks(tasks, 10);
+    TaskListWindow window;
+    window.update(tasks);
+    TEST_ASSERT_FALSE(window.takePage().has_value());
+}
+
+void test_requested_rows_are_delivered_once()
+{
+    device::TaskCollection tasks;
+    createTasks(tasks, 10);
+    TaskListWindow window;
+    std::size_t notifications = 0;
+    window.setRequestNotification([&notifications]() { ++notifications; });
+
+    window.request(3);
+    TEST_ASSERT_EQUAL_UINT(1, notifications);
+    window.update(tasks);
+    const auto page = window.takePage();
+    TEST_ASSERT_TRUE(page.has_value());
+    TEST_ASSERT_EQUAL_UINT(3, page->first);
+    TEST_ASSERT_EQUAL_UINT(10, page->numberOfTasks);
+    TEST_ASSERT_EQUAL_UINT(TaskListWindow::visibleRows, page->numberOfRows);
+    TEST_ASSERT_EQUAL_UINT(3, page->rows[0].id);
+    TEST_ASSERT_EQUAL_STRING("Task 3", page->rows[0].label.c_str());
+    TEST_ASSERT_EQUAL_STRING("Task 7", page->rows[4].label.c_str());
+    TEST_ASSERT_FALSE(page->rows[0].isRunning);
+
+    // unchanged
+    window.update(tasks);
+    TEST_ASSERT_FALSE(window.takePage().has_value());
+}
+
+void test_changes_are_delivered()
+{
+    device::TaskCollection tasks;
+    createTasks(tasks, 10);
+    TaskListWindow window;
+    window.request(0);
+    window.update(tasks);
+    window.takePage();
+
+    tasks.at(2).start();
+    tasks.at(4).setLabel("renamed");
+    window.update(tasks);
+    const auto page = window.takePage();
+    TEST_ASSERT_TRUE(page.has_value());
+    TEST_ASSERT_TRUE(page->rows[2].isRunning);
+    TEST_ASSERT_EQUAL_STRING("renamed", page->rows[4].label.c_str());
+
+    // changes outside of the window are not delivered
+    tasks.at(9).setLabel("invisible");
+    window.update(tasks);
+    TEST_ASSERT_FALSE(window.takePage().has_value());
+}
+
+void test_window_is_limited_to_the_end_of_the_list()
+{
+    device::TaskCollection tasks;
+    createTasks(tasks, 7);
+    TaskListWindow window;
+    window.request(6);
+    window.update(tasks);
+    auto page = window.takePage();
+    TEST_ASSERT_EQUAL_UINT(2, page->first);
+    TEST_ASSERT_EQUAL_UINT(TaskListWindow::visibleRows, page->numberOfRows);
+
+    tasks.clear();
+    createTasks(tasks, 3);
+    window.update(tasks);
+    page = window.takePage();
+    TEST_ASSERT_EQUAL_UINT(0, page->first);
+    TEST_ASSERT_EQUAL_UINT(3, page->numberOfRows);
+    TEST_ASSERT_EQUAL_UINT(3, page->numberOfTasks);
+}
+
+void test_only_the_latest_page_is_taken()
+{
+    device::TaskCollection tasks;
+    createTasks(tasks, 10);
+    TaskListWindow window;
+    window.request(1);
+    window.update(tasks);
+    window.request(2);
+    window.update(tasks);
+    const auto page = window.takePage();
+    TEST_ASSERT_EQUAL_UINT(2, page->first);
+    TEST_ASSERT_FALSE(window.takePage().has_value());
+}
+
+void test_closed_window_is_delivered_again_when_reopened()
+{
+    device::TaskCollection tasks;
+    createTasks(tasks, 10);
+    TaskListWindow window;
+    window.request(0);
+    window.update(tasks);
+    window.takePage();
+    window.close();
+    window.update(tasks);
+    TEST_ASSERT_FALSE(window.takePage().has_value());
+
+    window.request(0);
+    window.update(tasks);
+    TEST_ASSERT_TRUE(window.takePage().has_value());
+}
+
+void test_scrolling_does_not_allocate()
+{
+    constexpr TaskId numberOfTasks = 5'000;
+    device::TaskCollection tasks;
+    createTasks(tasks, numberOfTasks);
+    TaskListWindow window;
+    numberOfAllocations = 0;
+    for (std::size_t first = 0; first < numberOfTasks; ++first)
+    {
+        window.request(first);
+        window.update(tasks);
+        TEST_ASSERT_TRUE(window.takePage().has_value() || (first + TaskListWindow::visibleRows > numberOfTasks));
+    }
+    TEST_ASSERT_EQUAL_UINT(0, numberOfAllocations);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_nothing_is_delivered_unless_requested);
+    RUN_TEST(test_requested_rows_are_delivered_once);
+    RUN_TEST(test_changes_are_delivered);
+    RUN_TEST(test_window_is_limited_to_the_end_of_the_list);
+    RUN_TEST(test_only_the_latest_page_is_taken);
+    RUN_TEST(test_closed_window_is_delivered_again_when_reopened);
+    RUN_TEST(test_scrolling_does_not_allocate);
+
+    return UNITY_END();
+}
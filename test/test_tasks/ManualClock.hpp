@@ -0,0 +1,35 @@
+#pragma once
+#include <chrono>
+
+/**
+ * Clock which only advances when told so.
+ *
+ * Allows to test long durations without waiting for them.
+ * Meets the requirements of *Clock*.
+ */
+struct ManualClock
+{
+    typedef std::chrono::milliseconds duration;
+    typedef duration::rep rep;
+    typedef duration::period period;
+    typedef std::chrono::time_point<ManualClock> time_point;
+    static constexpr bool is_steady = true;
+
+    static time_point now() noexcept
+    {
+        return currentTime;
+    }
+
+    static void advance(const duration elapsed) noexcept
+    {
+        currentTime += elapsed;
+    }
+
+    static void reset() noexcept
+    {
+        currentTime = time_point();
+    }
+
+  private:
+    static inline time_point currentTime;
+};
@@ -1,12 +1,22 @@
+#include "ManualClock.hpp"
 #include "tasks/Task.hpp"
+#include <chrono>
 #include <iostream>
 #include <thread>
 #include <unity.h>
 
 static const Task::String label("äüöß");
 
+typedef BasicTask<ManualClock> ManualTask;
+
+/**
+ * Average duration of a year in the Gregorian calendar.
+ */
+typedef std::chrono::duration<long long, std::ratio<31'556'952>> Years;
+
 void setUp()
 {
+    ManualClock::reset();
 }
 
 void tearDown()
@@ -37,6 +47,107 @@ void test_time_elapses()
     TEST_ASSERT_EQUAL_UINT(durationToTest, task.getRecordedDuration().count());
 }
 
+void test_read_does_not_modify()
+{
+    Task task(label, Task::Duration(5));
+    task.start();
+    const Task &constTask = task;
+    const auto now = Task::Clock::now();
+    TEST_ASSERT_EQUAL_UINT(5, constTask.getRecordedDuration(now).count());
+    TEST_ASSERT_EQUAL_UINT(7, constTask.getRecordedDuration(now + Task::Duration(2)).count());
+    TEST_ASSERT_TRUE(constTask.isRunning());
+    TEST_ASSERT_EQUAL_UINT(5, constTask.getLastRecordedDuration().count());
+}
+
+void test_sample_at_one_instant()
+{
+    device::TaskCollection tasks;
+    tasks.emplace(1, "running", Task::Duration(10));
+    tasks.emplace(2, "idle", Task::Duration(20));
+    tasks.at(1).start();
+    std::this_thread::sleep_for(Task::Duration(1));
+
+    std::size_t numberOfSamples = 0;
+    device::sampleRecordedDurations(tasks, [&numberOfSamples](const TaskId id, const Task &task, const Task::Duration duration) {
+        numberOfSamples++;
+        TEST_ASSERT_EQUAL_UINT(task.isRunning() ? 11 : 20, duration.count());
+    });
+    TEST_ASSERT_EQUAL_UINT(2, numberOfSamples);
+}
+
+void test_manual_clock()
+{
+    ManualTask task(label);
+    task.start();
+    ManualClock::advance(std::chrono::milliseconds(1'499));
+    TEST_ASSERT_EQUAL_UINT(1, task.getRecordedDuration().count());
+    ManualClock::advance(std::chrono::milliseconds(1));
+    TEST_ASSERT_EQUAL_UINT(2, task.getRecordedDuration().count());
+    task.stop();
+    ManualClock::advance(std::chrono::hours(1));
+    TEST_ASSERT_EQUAL_UINT(2, task.getRecordedDuration().count());
+}
+
+void test_start_stop_at_given_time()
+{
+    ManualTask task(label);
+    const auto pressed = ManualClock::now();
+    ManualClock::advance(std::chrono::milliseconds(25)); // processing delay of the key press
+    task.start(pressed);
+    ManualClock::advance(std::chrono::milliseconds(2'000));
+    const auto released = ManualClock::now();
+    ManualClock::advance(std::chrono::milliseconds(40));
+    task.stop(released);
+    TEST_ASSERT_FALSE(task.isRunning());
+    TEST_ASSERT_EQUAL_UINT(2, task.getRecordedDuration().count());
+    TEST_ASSERT_EQUAL_UINT(1, task.getHistory().size());
+
+    // a stop before the start does not reduce the duration
+    task.start();
+    task.stop(pressed);
+    TEST_ASSERT_EQUAL_UINT(2, task.getRecordedDuration().count());
+}
+
+void test_multi_year_accumulation()
+{
+    ManualTask task(label, ManualTask::Duration(1));
+    task.start();
+    ManualClock::advance(Years(10));
+    task.stop();
+    TEST_ASSERT_EQUAL_INT64(std::chrono::duration_cast<std::chrono::seconds>(Years(10)).count() + 1, task.getRecordedDuration().count());
+
+    // fractions of seconds of many intervals must not get lost
+    ManualTask fragmented(label);
+    constexpr long long numberOfIntervals = 1'000'000;
+    for (long long interval = 0; interval < numberOfIntervals; ++interval)
+    {
+        fragmented.start();
+        ManualClock::advance(std::chrono::milliseconds(1'001));
+        fragmented.stop();
+        ManualClock::advance(std::chrono::milliseconds(10));
+    }
+    TEST_ASSERT_EQUAL_INT64(numberOfIntervals * 1'001 / 1'000, fragmented.getRecordedDuration().count());
+}
+
+void test_recorded_duration_within_window()
+{
+    ManualTask task(label);
+    const ManualTask::History::TimePoint dayBegin{};
+    const auto nextDayBegin = dayBegin + std::chrono::hours(24);
+
+    ManualClock::advance(std::chrono::hours(23));
+    task.start();
+    ManualClock::advance(std::chrono::hours(2)); // runs over the end of the window
+    task.stop();
+    ManualClock::advance(std::chrono::hours(1));
+    task.start();
+    ManualClock::advance(std::chrono::minutes(30)); // still running
+
+    TEST_ASSERT_EQUAL_UINT(1, task.getHistory().size());
+    TEST_ASSERT_EQUAL_INT64(3'600, task.getRecordedDurationWithin(dayBegin, nextDayBegin).count());
+    TEST_ASSERT_EQUAL_INT64(3'600 + 1'800, task.getRecordedDurationWithin(nextDayBegin, nextDayBegin + std::chrono::hours(24)).count());
+}
+
 void test_task_manager()
 {
     using namespace device;
@@ -64,6 +175,12 @@ int main(int argc, char **argv)
 
     RUN_TEST(test_get_label);
     RUN_TEST(test_time_elapses);
+    RUN_TEST(test_read_does_not_modify);
+    RUN_TEST(test_sample_at_one_instant);
+    RUN_TEST(test_manual_clock);
+    RUN_TEST(test_start_stop_at_given_time);
+    RUN_TEST(test_multi_year_accumulation);
+    RUN_TEST(test_recorded_duration_within_window);
     RUN_TEST(test_task_manager);
 
     UNITY_END();
@@ -0,0 +1,166 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <display_interface/ThreadedTransferWorker.hpp>
+#include <display_interface/TransferPipeline.hpp>
+#include <string>
+#include <thread>
+#include <unity.h>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+typedef std::chrono::steady_clock Clock;
+typedef page_layout::Area Area;
+
+constexpr page_layout::Coordinate displayWidth = 128;
+constexpr page_layout::Coordinate displayHeight = 64;
+constexpr Area fullFrame{.x1 = 0, .y1 = 0, .x2 = displayWidth - 1, .y2 = displayHeight - 1};
+
+/**
+ * Display which takes as long as an SSD1306 connected by I2C.
+ */
+class FakePanel : public IDisplayPanel
+{
+  public:
+    /**
+     * \param timePerByte time to transfer a byte; 9 clock cycles per byte at 400 kHz by default
+     */
+    explicit FakePanel(const Clock::duration timePerByte = 22'500ns) : timePerByte(timePerByte)
+    {
+    }
+
+    virtual void transfer(const std::uint8_t *framebuffer, const DirtyPages &changes) override
+    {
+        unsigned int bytes = 0;
+        changes.forEachWindow([&bytes](const DirtyPages::Window &window) { bytes += window.getNumberOfBytes(); });
+        firstByte = framebuffer[0];
+        std::this_thread::sleep_for(timePerByte * bytes);
+        transferredBytes += bytes;
+        ++frames;
+    }
+
+    const Clock::duration timePerByte;
+    std::atomic<unsigned int> frames{0};
+    std::atomic<unsigned int> transferredBytes{0};
+    std::atomic<std::uint8_t> firstByte{0};
+};
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_nothing_is_submitted_without_changes()
+{
+    FakePanel panel(0ns);
+    TransferPipeline pipeline(panel, displayWidth, displayHeight);
+    TEST_ASSERT_FALSE(pipeline.hasPendingChanges());
+    TEST_ASSERT_FALSE(pipeline.submit());
+    pipeline.transfer();
+    TEST_ASSERT_EQUAL_UINT(0, panel.frames.load());
+}
+
+void test_submitted_frame_is_transferred()
+{
+    FakePanel panel(0ns);
+    TransferPipeline pipeline(panel, displayWidth, displayHeight);
+    pipeline.getBackBuffer()[0] = 0x5A;
+    pipeline.mark(Area{.x1 = 0, .y1 = 0, .x2 = 9, .y2 = 7});
+    TEST_ASSERT_TRUE(pipeline.hasPendingChanges());
+    TEST_ASSERT_TRUE(pipeline.submit());
+    TEST_ASSERT_FALSE(pipeline.hasPendingChanges());
+
+    // the renderer continues while the frame is transferred
+    pipeline.getBackBuffer()[0] = 0xFF;
+    pipeline.transfer();
+    TEST_ASSERT_EQUAL_UINT(1, panel.frames.load());
+    TEST_ASSERT_EQUAL_UINT(10, panel.transferredBytes.load());
+    TEST_ASSERT_EQUAL_HEX8(0x5A, panel.firstByte.load());
+}
+
+void test_changes_are_kept_while_transferring()
+{
+    FakePanel panel(0ns);
+    TransferPipeline pipeline(panel, displayWidth, displayHeight);
+    pipeline.mark(Area{.x1 = 0, .y1 = 0, .x2 = 9, .y2 = 7});
+    TEST_ASSERT_TRUE(pipeline.submit());
+    pipeline.mark(Area{.x1 = 0, .y1 = 8, .x2 = 19, .y2 = 15});
+    TEST_ASSERT_FALSE(pipeline.submit()); // previous frame is not transferred yet
+    TEST_ASSERT_TRUE(pipeline.hasPendingChanges());
+
+    pipeline.transfer();
+    TEST_ASSERT_TRUE(pipeline.submit());
+    pipeline.transfer();
+    TEST_ASSERT_EQUAL_UINT(2, panel.frames.load());
+    TEST_ASSERT_EQUAL_UINT(10 + 20, panel.transferredBytes.load());
+}
+
+/**
+ * Compares rendering and transferring frames one after the other with the pipeline.
+ */
+void test_benchmark_overlapping_transfer()
+{
+    constexpr unsigned int numberOfFrames = 10;
+    constexpr auto renderTime = 25ms; // a little longer than transferring a full frame
+
+    FakePanel sequentialPanel;
+    TransferPipeline sequential(sequentialPanel, displayWidth, displayHeight);
+    const auto beginOfSequential = Clock::now();
+    for (unsigned int frame = 0; frame < numberOfFrames; ++frame)
+    {
+        std::this_thread::sleep_for(renderTime);
+        sequential.mark(fullFrame);
+        sequential.submit();
+        sequential.transfer();
+    }
+    const auto sequentialTime = Clock::now() - beginOfSequential;
+
+    FakePanel pipelinedPanel;
+    TransferPipeline pipelined(pipelinedPanel, displayWidth, displayHeight);
+    const auto beginOfPipelined = Clock::now();
+    {
+        ThreadedTransferWorker worker([&pipelined]() { pipelined.transfer(); });
+        for (unsigned int frame = 0; frame < numberOfFrames; ++frame)
+        {
+            std::this_thread::sleep_for(renderTime);
+            pipelined.mark(fullFrame);
+            if (pipelined.submit())
+            {
+                worker.trigger();
+            }
+        }
+        // wait for the last frame
+        while (pipelined.hasPendingChanges() || pipelined.isTransferring())
+        {
+            if (pipelined.submit())
+            {
+                worker.trigger();
+            }
+            std::this_thread::sleep_for(1ms);
+        }
+    }
+    const auto pipelinedTime = Clock::now() - beginOfPipelined;
+
+    const auto toMilliseconds = [](const Clock::duration duration) { return std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(duration).count()); };
+    const std::string message = "sequential " + toMilliseconds(sequentialTime) + " ms, " + std::to_string(sequentialPanel.frames.load()) + " frames; " +
+                                "pipelined " + toMilliseconds(pipelinedTime) + " ms, " + std::to_string(pipelinedPanel.frames.load()) + " frames";
+    TEST_MESSAGE(message.c_str());
+    TEST_ASSERT_EQUAL_UINT(numberOfFrames, sequentialPanel.frames.load());
+    TEST_ASSERT_TRUE(pipelinedTime < sequentialTime);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_nothing_is_submitted_without_changes);
+    RUN_TEST(test_submitted_frame_is_transferred);
+    RUN_TEST(test_changes_are_kept_while_transferring);
+    RUN_TEST(test_benchmark_overlapping_transfer);
+
+    return UNITY_END();
+}
@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+"""
+Measures the round-trip latency of commands sent to the device via the serial port.
+
+Sends a command repeatedly and measures the time until the complete response has been received.
+A response is either a single line or a JSON document, which the device prints over several lines.
+Prints statistics of the measured latencies.
+
+Requires pyserial (`pip install pyserial`).
+
+Example:
+
+    python tools/measure_serial_latency.py /dev/ttyUSB0 --count 200
+"""
+import argparse
+import json
+import statistics
+import sys
+import time
+
+import serial
+
+
+def read_response(port: serial.Serial) -> bytes:
+    """Reads a single line or, if it begins a JSON document, all lines up to its end; empty on timeout."""
+    response = port.readline()
+    if not response.lstrip().startswith((b"{", b"[")):
+        return response
+    while True:
+        try:
+            json.loads(response)
+            return response
+        except ValueError:
+            line = port.readline()
+            if not line:
+                return b""
+            response += line
+
+
+def measure(port: serial.Serial, command: str, count: int, pause: float) -> list[float]:
+    latencies = []
+    for _ in range(count):
+        port.reset_input_buffer()
+        begin = time.perf_counter()
+        port.write((command + "\n").encode())
+        response = read_response(port)
+        end = time.perf_counter()
+        if not response:
+            print("no response within timeout", file=sys.stderr)
+            continue
+        latencies.append((end - begin) * 1000)
+        # let the device settle; also randomizes the phase relative to its main loop
+        time.sleep(pause)
+        port.reset_input_buffer()
+    return latencies
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("port", help="serial port of the device, e.g. /dev/ttyUSB0 or COM3")
+    parser.add_argument("--baudrate", type=int, default=115200)
+    parser.add_argument("--command", default="info", help="command to send, e.g. 'list' or 'stats'")
+    parser.add_argument("--count", type=int, default=100, help="number of measurements")
+    parser.add_argument("--pause", type=float, default=0.05, help="seconds to wait between the measurements")
+    arguments = parser.parse_args()
+
+    with serial.Serial(arguments.port, arguments.baudrate, timeout=2) as port:
+        time.sleep(0.5)
+        port.reset_input_buffer()
+        latencies = measure(port, arguments.command, arguments.count, arguments.pause)
+
+    if not latencies:
+        print("no measurements", file=sys.stderr)
+        return 1
+    latencies.sort()
+    percentile95 = latencies[min(len(latencies) - 1, int(len(latencies) * 0.95))]
+    print(f"command:  {arguments.command!r}")
+    print(f"samples:  {len(latencies)}")
+    print(f"min:      {latencies[0]:.1f} ms")
+    print(f"median:   {statistics.median(latencies):.1f} ms")
+    print(f"95th pct: {percentile95:.1f} ms")
+    print(f"max:      {latencies[-1]:.1f} ms")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())